@@ -93,6 +93,56 @@ encaps(benchmark::State& state)
   state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark Saber KEM encapsulation algorithm, against a public key which is prepared
+// ( i.e. expanded, unpacked and hashed ) only once, outside of benchmark loop.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling>
+void
+encaps_prepared(benchmark::State& state)
+{
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+
+  std::vector<uint8_t> seedA(seedBytes);
+  std::vector<uint8_t> seedS(noiseBytes);
+  std::vector<uint8_t> z(keyBytes);
+  std::vector<uint8_t> m(keyBytes);
+  std::vector<uint8_t> pkey(pklen);
+  std::vector<uint8_t> skey(sklen);
+  std::vector<uint8_t> ctxt(ctlen);
+  std::vector<uint8_t> seskey(sha3_256::DIGEST_LEN);
+
+  prng::prng_t prng;
+
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(z);
+  prng.read(m);
+
+  auto _seedA = std::span<const uint8_t, seedBytes>(seedA);
+  auto _seedS = std::span<const uint8_t, noiseBytes>(seedS);
+  auto _z = std::span<const uint8_t, keyBytes>(z);
+  auto _m = std::span<const uint8_t, keyBytes>(m);
+  auto _pkey = std::span<uint8_t, pklen>(pkey);
+  auto _skey = std::span<uint8_t, sklen>(skey);
+  auto _ctxt = std::span<uint8_t, ctlen>(ctxt);
+  auto _seskey = std::span<uint8_t, sha3_256::DIGEST_LEN>(seskey);
+
+  _saber_kem::keygen<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling>(_seedA, _seedS, _z, _pkey, _skey);
+  const _saber_kem::prepared_pkey_t<L, EQ, EP, seedBytes> pkey_prep(_pkey);
+
+  for (auto _ : state) {
+    _saber_kem::encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_m, pkey_prep, _ctxt, _seskey);
+
+    benchmark::DoNotOptimize(_m);
+    benchmark::DoNotOptimize(_ctxt);
+    benchmark::DoNotOptimize(_seskey);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
 // Benchmark Saber KEM decapsulation algorithm for various suggested parameters.
 template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling>
 void
@@ -145,6 +195,204 @@ decaps(benchmark::State& state)
   state.SetItemsProcessed(state.iterations());
 }
 
+// Benchmark Saber KEM decapsulation algorithm, under a secret key which is prepared (
+// i.e. unpacked and expanded ) only once, outside of benchmark loop.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling>
+void
+decaps_prepared(benchmark::State& state)
+{
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+
+  std::vector<uint8_t> seedA(seedBytes);
+  std::vector<uint8_t> seedS(noiseBytes);
+  std::vector<uint8_t> z(keyBytes);
+  std::vector<uint8_t> m(keyBytes);
+  std::vector<uint8_t> pkey(pklen);
+  std::vector<uint8_t> skey(sklen);
+  std::vector<uint8_t> ctxt(ctlen);
+  std::vector<uint8_t> seskey0(sha3_256::DIGEST_LEN);
+  std::vector<uint8_t> seskey1(sha3_256::DIGEST_LEN);
+
+  prng::prng_t prng;
+
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(z);
+  prng.read(m);
+
+  auto _seedA = std::span<const uint8_t, seedBytes>(seedA);
+  auto _seedS = std::span<const uint8_t, noiseBytes>(seedS);
+  auto _z = std::span<const uint8_t, keyBytes>(z);
+  auto _m = std::span<const uint8_t, keyBytes>(m);
+  auto _pkey = std::span<uint8_t, pklen>(pkey);
+  auto _skey = std::span<uint8_t, sklen>(skey);
+  auto _ctxt = std::span<uint8_t, ctlen>(ctxt);
+  auto _seskey0 = std::span<uint8_t, sha3_256::DIGEST_LEN>(seskey0);
+  auto _seskey1 = std::span<uint8_t, sha3_256::DIGEST_LEN>(seskey1);
+
+  _saber_kem::keygen<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling>(_seedA, _seedS, _z, _pkey, _skey);
+  _saber_kem::encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_m, _pkey, _ctxt, _seskey0);
+
+  const _saber_kem::prepared_skey_t<L, EQ, EP, seedBytes, keyBytes> skey_prep(_skey);
+
+  for (auto _ : state) {
+    _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_ctxt, skey_prep, _seskey1);
+
+    benchmark::DoNotOptimize(_ctxt);
+    benchmark::DoNotOptimize(_seskey1);
+    benchmark::ClobberMemory();
+  }
+
+  assert(std::ranges::equal(_seskey0, _seskey1));
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Number of operations, performed by each call to batched Saber KEM routines.
+constexpr size_t BATCH = 8;
+
+// Benchmark batched Saber KEM key generation, reporting throughput per keypair.
+template<size_t L, size_t EQ, size_t EP, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling>
+void
+keygen_batch(benchmark::State& state)
+{
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+
+  std::vector<uint8_t> seedA(BATCH * seedBytes);
+  std::vector<uint8_t> seedS(BATCH * noiseBytes);
+  std::vector<uint8_t> z(BATCH * keyBytes);
+  std::vector<uint8_t> pkey(BATCH * pklen);
+  std::vector<uint8_t> skey(BATCH * sklen);
+
+  prng::prng_t prng;
+
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(z);
+
+  auto _seedA = std::span<const uint8_t, BATCH * seedBytes>(seedA);
+  auto _seedS = std::span<const uint8_t, BATCH * noiseBytes>(seedS);
+  auto _z = std::span<const uint8_t, BATCH * keyBytes>(z);
+  auto _pkey = std::span<uint8_t, BATCH * pklen>(pkey);
+  auto _skey = std::span<uint8_t, BATCH * sklen>(skey);
+
+  for (auto _ : state) {
+    _saber_kem::keygen_batch<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling, BATCH>(_seedA, _seedS, _z, _pkey, _skey);
+
+    benchmark::DoNotOptimize(_seedA);
+    benchmark::DoNotOptimize(_seedS);
+    benchmark::DoNotOptimize(_z);
+    benchmark::DoNotOptimize(_pkey);
+    benchmark::DoNotOptimize(_skey);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+// Benchmark batched Saber KEM encapsulation, reporting throughput per encapsulation.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling>
+void
+encaps_batch(benchmark::State& state)
+{
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+
+  std::vector<uint8_t> seedA(BATCH * seedBytes);
+  std::vector<uint8_t> seedS(BATCH * noiseBytes);
+  std::vector<uint8_t> z(BATCH * keyBytes);
+  std::vector<uint8_t> m(BATCH * keyBytes);
+  std::vector<uint8_t> pkey(BATCH * pklen);
+  std::vector<uint8_t> skey(BATCH * sklen);
+  std::vector<uint8_t> ctxt(BATCH * ctlen);
+  std::vector<uint8_t> seskey(BATCH * sha3_256::DIGEST_LEN);
+
+  prng::prng_t prng;
+
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(z);
+  prng.read(m);
+
+  auto _m = std::span<const uint8_t, BATCH * keyBytes>(m);
+  auto _pkey = std::span<uint8_t, BATCH * pklen>(pkey);
+  auto _ctxt = std::span<uint8_t, BATCH * ctlen>(ctxt);
+  auto _seskey = std::span<uint8_t, BATCH * sha3_256::DIGEST_LEN>(seskey);
+
+  _saber_kem::keygen_batch<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling, BATCH>(std::span<const uint8_t, BATCH * seedBytes>(seedA),
+                                                                                                    std::span<const uint8_t, BATCH * noiseBytes>(seedS),
+                                                                                                    std::span<const uint8_t, BATCH * keyBytes>(z),
+                                                                                                    _pkey,
+                                                                                                    std::span<uint8_t, BATCH * sklen>(skey));
+
+  for (auto _ : state) {
+    _saber_kem::encaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, BATCH>(_m, _pkey, _ctxt, _seskey);
+
+    benchmark::DoNotOptimize(_m);
+    benchmark::DoNotOptimize(_pkey);
+    benchmark::DoNotOptimize(_ctxt);
+    benchmark::DoNotOptimize(_seskey);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+// Benchmark batched Saber KEM decapsulation, reporting throughput per decapsulation.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling>
+void
+decaps_batch(benchmark::State& state)
+{
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+
+  std::vector<uint8_t> seedA(BATCH * seedBytes);
+  std::vector<uint8_t> seedS(BATCH * noiseBytes);
+  std::vector<uint8_t> z(BATCH * keyBytes);
+  std::vector<uint8_t> m(BATCH * keyBytes);
+  std::vector<uint8_t> pkey(BATCH * pklen);
+  std::vector<uint8_t> skey(BATCH * sklen);
+  std::vector<uint8_t> ctxt(BATCH * ctlen);
+  std::vector<uint8_t> seskey0(BATCH * sha3_256::DIGEST_LEN);
+  std::vector<uint8_t> seskey1(BATCH * sha3_256::DIGEST_LEN);
+
+  prng::prng_t prng;
+
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(z);
+  prng.read(m);
+
+  auto _pkey = std::span<uint8_t, BATCH * pklen>(pkey);
+  auto _skey = std::span<uint8_t, BATCH * sklen>(skey);
+  auto _ctxt = std::span<uint8_t, BATCH * ctlen>(ctxt);
+  auto _seskey0 = std::span<uint8_t, BATCH * sha3_256::DIGEST_LEN>(seskey0);
+  auto _seskey1 = std::span<uint8_t, BATCH * sha3_256::DIGEST_LEN>(seskey1);
+
+  _saber_kem::keygen_batch<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling, BATCH>(std::span<const uint8_t, BATCH * seedBytes>(seedA),
+                                                                                                    std::span<const uint8_t, BATCH * noiseBytes>(seedS),
+                                                                                                    std::span<const uint8_t, BATCH * keyBytes>(z),
+                                                                                                    _pkey,
+                                                                                                    _skey);
+  _saber_kem::encaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, BATCH>(std::span<const uint8_t, BATCH * keyBytes>(m), _pkey, _ctxt, _seskey0);
+
+  for (auto _ : state) {
+    _saber_kem::decaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, BATCH>(_ctxt, _skey, _seskey1);
+
+    benchmark::DoNotOptimize(_ctxt);
+    benchmark::DoNotOptimize(_skey);
+    benchmark::DoNotOptimize(_seskey1);
+    benchmark::ClobberMemory();
+  }
+
+  assert(std::ranges::equal(_seskey0, _seskey1));
+  state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
 const auto compute_min = [](const std::vector<double>& v) -> double { return *std::min_element(v.begin(), v.end()); };
 const auto compute_max = [](const std::vector<double>& v) -> double { return *std::max_element(v.begin(), v.end()); };
 
@@ -152,24 +400,54 @@ const auto compute_max = [](const std::vector<double>& v) -> double { return *st
 // uFireSaber KEM routines.
 BENCHMARK(keygen<2, 13, 10, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/keygen");
 BENCHMARK(encaps<2, 13, 10, 3, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/encaps");
+BENCHMARK(encaps_prepared<2, 13, 10, 3, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/encaps/prepared");
 BENCHMARK(decaps<2, 13, 10, 3, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/decaps");
+BENCHMARK(decaps_prepared<2, 13, 10, 3, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/decaps/prepared");
+BENCHMARK(keygen_batch<2, 13, 10, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/keygen/batch");
+BENCHMARK(encaps_batch<2, 13, 10, 3, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/encaps/batch");
+BENCHMARK(decaps_batch<2, 13, 10, 3, 10, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("lightsaber/decaps/batch");
 
 BENCHMARK(keygen<3, 13, 10, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/keygen");
 BENCHMARK(encaps<3, 13, 10, 4, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/encaps");
+BENCHMARK(encaps_prepared<3, 13, 10, 4, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/encaps/prepared");
 BENCHMARK(decaps<3, 13, 10, 4, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/decaps");
+BENCHMARK(decaps_prepared<3, 13, 10, 4, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/decaps/prepared");
+BENCHMARK(keygen_batch<3, 13, 10, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/keygen/batch");
+BENCHMARK(encaps_batch<3, 13, 10, 4, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/encaps/batch");
+BENCHMARK(decaps_batch<3, 13, 10, 4, 8, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("saber/decaps/batch");
 
 BENCHMARK(keygen<4, 13, 10, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/keygen");
 BENCHMARK(encaps<4, 13, 10, 6, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/encaps");
+BENCHMARK(encaps_prepared<4, 13, 10, 6, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/encaps/prepared");
 BENCHMARK(decaps<4, 13, 10, 6, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/decaps");
+BENCHMARK(decaps_prepared<4, 13, 10, 6, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/decaps/prepared");
+BENCHMARK(keygen_batch<4, 13, 10, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/keygen/batch");
+BENCHMARK(encaps_batch<4, 13, 10, 6, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/encaps/batch");
+BENCHMARK(decaps_batch<4, 13, 10, 6, 6, 32, 32, 32, false>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("firesaber/decaps/batch");
 
 BENCHMARK(keygen<2, 12, 10, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/keygen");
 BENCHMARK(encaps<2, 12, 10, 3, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/encaps");
+BENCHMARK(encaps_prepared<2, 12, 10, 3, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/encaps/prepared");
 BENCHMARK(decaps<2, 12, 10, 3, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/decaps");
+BENCHMARK(decaps_prepared<2, 12, 10, 3, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/decaps/prepared");
+BENCHMARK(keygen_batch<2, 12, 10, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/keygen/batch");
+BENCHMARK(encaps_batch<2, 12, 10, 3, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/encaps/batch");
+BENCHMARK(decaps_batch<2, 12, 10, 3, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ulightsaber/decaps/batch");
 
 BENCHMARK(keygen<3, 12, 10, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/keygen");
 BENCHMARK(encaps<3, 12, 10, 4, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/encaps");
+BENCHMARK(encaps_prepared<3, 12, 10, 4, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/encaps/prepared");
 BENCHMARK(decaps<3, 12, 10, 4, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/decaps");
+BENCHMARK(decaps_prepared<3, 12, 10, 4, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/decaps/prepared");
+BENCHMARK(keygen_batch<3, 12, 10, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/keygen/batch");
+BENCHMARK(encaps_batch<3, 12, 10, 4, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/encaps/batch");
+BENCHMARK(decaps_batch<3, 12, 10, 4, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("usaber/decaps/batch");
 
 BENCHMARK(keygen<4, 12, 10, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/keygen");
 BENCHMARK(encaps<4, 12, 10, 6, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/encaps");
+BENCHMARK(encaps_prepared<4, 12, 10, 6, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/encaps/prepared");
 BENCHMARK(decaps<4, 12, 10, 6, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/decaps");
+BENCHMARK(decaps_prepared<4, 12, 10, 6, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/decaps/prepared");
+BENCHMARK(keygen_batch<4, 12, 10, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/keygen/batch");
+BENCHMARK(encaps_batch<4, 12, 10, 6, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/encaps/batch");
+BENCHMARK(decaps_batch<4, 12, 10, 6, 2, 32, 32, 32, true>)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max)->Name("ufiresaber/decaps/batch");
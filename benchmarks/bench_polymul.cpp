@@ -0,0 +1,305 @@
+#include "karatsuba.hpp"
+#include "kronecker.hpp"
+#include "ntt.hpp"
+#include "poly_matrix.hpp"
+#include "polymul_batch.hpp"
+#include "prng.hpp"
+#include "smallmul.hpp"
+#include "toom_cook.hpp"
+#include <benchmark/benchmark.h>
+
+// Generates a random polynomial over Zq, s.t. q = 2^13.
+static std::array<zq::zq_t, poly::N>
+random_poly(prng::prng_t& prng)
+{
+  constexpr size_t blen = (saber_params::log2(1u << 13) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr(blen, 0);
+  prng.read(bstr);
+
+  return poly::poly_t<(1u << 13)>(bstr).as_array();
+}
+
+// Benchmark multiplication of two degree-255 polynomials over Rq, using one of the
+// available polynomial multiplication algorithms.
+template<std::array<zq::zq_t, poly::N> (*mul)(const std::array<zq::zq_t, poly::N>&, const std::array<zq::zq_t, poly::N>&)>
+void
+poly_mul(benchmark::State& state)
+{
+  prng::prng_t prng;
+
+  auto polya = random_poly(prng);
+  auto polyb = random_poly(prng);
+  std::array<zq::zq_t, poly::N> polyab{};
+
+  for (auto _ : state) {
+    polyab = mul(polya, polyb);
+
+    benchmark::DoNotOptimize(polya);
+    benchmark::DoNotOptimize(polyb);
+    benchmark::DoNotOptimize(polyab);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark batched multiplication of `polymul_batch::LANES` -many independent pairs of
+// degree-255 polynomials over Rq, including transposition to and from coefficient-major
+// layout. Items processed are reported per pair, so that it can be compared with above.
+void
+poly_mul_batched(benchmark::State& state)
+{
+  constexpr size_t lanes = polymul_batch::LANES;
+  constexpr uint16_t moduli = 1u << 13;
+
+  prng::prng_t prng;
+
+  std::array<poly::poly_t<moduli>, lanes> polya;
+  std::array<poly::poly_t<moduli>, lanes> polyb;
+  std::array<poly::poly_t<moduli>, lanes> polyab;
+
+  for (size_t l = 0; l < lanes; l++) {
+    polya[l] = random_poly(prng);
+    polyb[l] = random_poly(prng);
+  }
+
+  for (auto _ : state) {
+    polymul_batch::polymul<moduli, lanes>(polya, polyb, polyab);
+
+    benchmark::DoNotOptimize(polya);
+    benchmark::DoNotOptimize(polyb);
+    benchmark::DoNotOptimize(polyab);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * lanes);
+}
+
+// Benchmark multiplication of a matrix M ∈ Rq^(l×l) and vector v ∈ Rq^(l×1), with
+// matrix kept in either polynomial-major layout ( which is multiplied in evaluation
+// domain of selected backend ) or coefficient-major layout ( which is multiplied using
+// batched Karatsuba, one element polynomial per lane ).
+template<size_t L, bool coeff_major>
+void
+mat_vec_mul(benchmark::State& state)
+{
+  constexpr uint16_t moduli = 1u << 13;
+
+  prng::prng_t prng;
+
+  mat::poly_matrix_t<L, L, moduli> mat;
+  mat::poly_matrix_t<L, 1, moduli> vec;
+  mat::poly_matrix_t<L, 1, moduli> res;
+
+  for (size_t i = 0; i < L; i++) {
+    for (size_t j = 0; j < L; j++) {
+      mat[{ i, j }] = random_poly(prng);
+    }
+    vec[i] = random_poly(prng);
+  }
+
+  const mat::poly_matrix_cm_t<L, L, moduli> mat_cm(mat);
+
+  for (auto _ : state) {
+    if constexpr (coeff_major) {
+      res = mat_cm.mat_vec_mul(vec);
+    } else {
+      res = mat.mat_vec_mul(vec);
+    }
+
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(vec);
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark multiplication of a matrix A ∈ Rq^(l×l) and secret vector s ∈ Rq^(l×1) ( as
+// sampled by `gen_secret` ), both being evaluated, in evaluation domain of either selected
+// backend or small-secret multiplier ( see `smallmul` ), which exploits small magnitude
+// of secret coefficients.
+template<size_t L, typename D>
+void
+secret_mat_vec_mul(benchmark::State& state)
+{
+  constexpr uint16_t moduli = 1u << 13;
+
+  prng::prng_t prng;
+
+  std::array<uint8_t, 32> seed;
+  prng.read(seed);
+
+  mat::poly_matrix_t<L, L, moduli> mat;
+  mat::poly_matrix_t<L, 1, moduli> res;
+
+  for (size_t i = 0; i < L; i++) {
+    for (size_t j = 0; j < L; j++) {
+      mat[{ i, j }] = random_poly(prng);
+    }
+  }
+
+  const auto vec = mat::poly_matrix_t<L, 1, moduli>::template gen_secret<false, seed.size(), 8>(seed);
+
+  for (auto _ : state) {
+    res = mat.template evaluate<D>().template mat_vec_mul<moduli>(vec.template evaluate<D>());
+
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(vec);
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmark expansion of matrix A ∈ Rq^(l×l) from seed, either one matrix at a time, using
+// scalar SHAKE128, or `keccak_batch::LANES` -many at a time, using multi-buffer SHAKE128.
+// Items processed are reported per matrix, so that both can be compared.
+template<size_t L, bool batched>
+void
+gen_matrix(benchmark::State& state)
+{
+  constexpr uint16_t moduli = 1u << 13;
+  constexpr size_t seedBytes = 32;
+  constexpr size_t lanes = keccak_batch::LANES;
+
+  prng::prng_t prng;
+
+  std::array<std::array<uint8_t, seedBytes>, lanes> seeds;
+  std::array<std::span<const uint8_t>, lanes> _seeds;
+
+  for (size_t k = 0; k < lanes; k++) {
+    prng.read(seeds[k]);
+    _seeds[k] = seeds[k];
+  }
+
+  for (auto _ : state) {
+    if constexpr (batched) {
+      auto mats = mat::poly_matrix_t<L, L, moduli>::template gen_matrix_batch<lanes>(_seeds);
+      benchmark::DoNotOptimize(mats);
+    } else {
+      for (size_t k = 0; k < lanes; k++) {
+        auto mat = mat::poly_matrix_t<L, L, moduli>::template gen_matrix<seedBytes>(seeds[k]);
+        benchmark::DoNotOptimize(mat);
+      }
+    }
+
+    benchmark::DoNotOptimize(seeds);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * lanes);
+}
+
+// Benchmark matrix vector multiplications of a group of `keccak_batch::LANES` -many
+// independent operations ( as done by batched KEM routines ), either one operation at a
+// time, in evaluation domain of selected backend, where each vector is evaluated only
+// once, or all l * l products of whole group together, using batched Karatsuba, in
+// chunks of `polymul_batch::LANES` -many pairs ( last one padded ), before rows are
+// summed up. Items processed are reported per matrix vector multiplication.
+template<size_t L, bool batched>
+void
+mat_vec_mul_group(benchmark::State& state)
+{
+  constexpr uint16_t moduli = 1u << 13;
+  constexpr size_t group = keccak_batch::LANES;
+  constexpr size_t lanes = polymul_batch::LANES;
+  constexpr size_t prods = group * L * L;
+  constexpr size_t chunks = (prods + lanes - 1) / lanes;
+
+  prng::prng_t prng;
+
+  std::array<mat::poly_matrix_t<L, L, moduli>, group> mats;
+  std::array<mat::poly_matrix_t<L, 1, moduli>, group> vecs;
+  std::array<mat::poly_matrix_t<L, 1, moduli>, group> res;
+
+  for (size_t k = 0; k < group; k++) {
+    for (size_t i = 0; i < L; i++) {
+      for (size_t j = 0; j < L; j++) {
+        mats[k][{ i, j }] = random_poly(prng);
+      }
+      vecs[k][i] = random_poly(prng);
+    }
+  }
+
+  std::array<poly::poly_t<moduli>, chunks * lanes> polya{};
+  std::array<poly::poly_t<moduli>, chunks * lanes> polyb{};
+  std::array<poly::poly_t<moduli>, chunks * lanes> polyab;
+
+  for (auto _ : state) {
+    if constexpr (batched) {
+      for (size_t k = 0; k < group; k++) {
+        for (size_t i = 0; i < L; i++) {
+          for (size_t j = 0; j < L; j++) {
+            polya[(k * L + i) * L + j] = mats[k][{ i, j }];
+            polyb[(k * L + i) * L + j] = vecs[k][j];
+          }
+        }
+      }
+
+      for (size_t c = 0; c < chunks; c++) {
+        polymul_batch::polymul<moduli, lanes>(std::span<const poly::poly_t<moduli>, lanes>(polya.data() + c * lanes, lanes),
+                                              std::span<const poly::poly_t<moduli>, lanes>(polyb.data() + c * lanes, lanes),
+                                              std::span<poly::poly_t<moduli>, lanes>(polyab.data() + c * lanes, lanes));
+      }
+
+      for (size_t k = 0; k < group; k++) {
+        for (size_t i = 0; i < L; i++) {
+          res[k][i] = polyab[(k * L + i) * L];
+          for (size_t j = 1; j < L; j++) {
+            res[k][i] += polyab[(k * L + i) * L + j];
+          }
+        }
+      }
+    } else {
+      for (size_t k = 0; k < group; k++) {
+        res[k] = mats[k].mat_vec_mul(vecs[k]);
+      }
+    }
+
+    benchmark::DoNotOptimize(mats);
+    benchmark::DoNotOptimize(vecs);
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * group);
+}
+
+// Register for benchmarking all polynomial multiplication algorithms, side by side.
+BENCHMARK(poly_mul<karatsuba::karamul<poly::N>>)->Name("polymul/karatsuba");
+BENCHMARK(poly_mul<toom_cook::toom4mul<poly::N>>)->Name("polymul/toom_cook");
+BENCHMARK(poly_mul<ntt::polymul>)->Name("polymul/ntt");
+BENCHMARK(poly_mul<kronecker::kronmul<poly::N>>)->Name("polymul/kronecker");
+BENCHMARK(poly_mul_batched)->Name("polymul/batched");
+
+BENCHMARK(mat_vec_mul<2, false>)->Name("matvec/l2");
+BENCHMARK(mat_vec_mul<2, true>)->Name("matvec/l2/coeff_major");
+BENCHMARK(mat_vec_mul<3, false>)->Name("matvec/l3");
+BENCHMARK(mat_vec_mul<3, true>)->Name("matvec/l3/coeff_major");
+BENCHMARK(mat_vec_mul<4, false>)->Name("matvec/l4");
+BENCHMARK(mat_vec_mul<4, true>)->Name("matvec/l4/coeff_major");
+
+BENCHMARK(secret_mat_vec_mul<2, polymul::domain_t>)->Name("matvec/secret/l2");
+BENCHMARK(secret_mat_vec_mul<2, smallmul::domain_t>)->Name("matvec/secret/l2/small");
+BENCHMARK(secret_mat_vec_mul<3, polymul::domain_t>)->Name("matvec/secret/l3");
+BENCHMARK(secret_mat_vec_mul<3, smallmul::domain_t>)->Name("matvec/secret/l3/small");
+BENCHMARK(secret_mat_vec_mul<4, polymul::domain_t>)->Name("matvec/secret/l4");
+BENCHMARK(secret_mat_vec_mul<4, smallmul::domain_t>)->Name("matvec/secret/l4/small");
+
+BENCHMARK(mat_vec_mul_group<2, false>)->Name("matvec/group/l2");
+BENCHMARK(mat_vec_mul_group<2, true>)->Name("matvec/group/l2/batched");
+BENCHMARK(mat_vec_mul_group<3, false>)->Name("matvec/group/l3");
+BENCHMARK(mat_vec_mul_group<3, true>)->Name("matvec/group/l3/batched");
+BENCHMARK(mat_vec_mul_group<4, false>)->Name("matvec/group/l4");
+BENCHMARK(mat_vec_mul_group<4, true>)->Name("matvec/group/l4/batched");
+
+BENCHMARK(gen_matrix<2, false>)->Name("gen_matrix/l2");
+BENCHMARK(gen_matrix<2, true>)->Name("gen_matrix/l2/batched");
+BENCHMARK(gen_matrix<3, false>)->Name("gen_matrix/l3");
+BENCHMARK(gen_matrix<3, true>)->Name("gen_matrix/l3/batched");
+BENCHMARK(gen_matrix<4, false>)->Name("gen_matrix/l4");
+BENCHMARK(gen_matrix<4, true>)->Name("gen_matrix/l4/batched");
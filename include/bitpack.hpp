@@ -0,0 +1,493 @@
+#pragma once
+#include "dispatch.hpp"
+#include "zq.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#if defined SABER_DISPATCH
+#include <immintrin.h>
+#endif
+
+// Vectorized ( AVX2 ) and BMI2 based packing/ unpacking of degree-255 polynomials, whose
+// coefficients are `w` -bit wide, to/ from byte strings of length w * 32, producing same
+// little-endian bit stream as portable implementation in `poly::poly_t`. Also fused
+// kernels, which round coefficients right before packing them.
+namespace bitpack {
+
+// For all parameter sets of Saber KEM, degree of polynomials over Zq is 255.
+constexpr size_t N = 256;
+
+// Coefficients of a polynomial, which is subtracted by fused rounding kernels, can be held
+// as 16 -bit elements of Zq, as 8 -bit lanes ( for q <= 2^8 ) or as a bitset of N / 8
+// -bytes ( for q = 2 ). Following routines read k-th coefficient of any of them.
+static inline constexpr uint16_t
+load_coeff(std::span<const zq::zq_t, N> s, const size_t k)
+{
+  return s[k].as_raw();
+}
+
+static inline constexpr uint16_t
+load_coeff(std::span<const uint8_t, N> s, const size_t k)
+{
+  return s[k];
+}
+
+static inline constexpr uint16_t
+load_coeff(std::span<const uint8_t, N / 8> s, const size_t k)
+{
+  return (s[k / 8] >> (k % 8)) & 1;
+}
+
+// Given a byte string of length w * 32, this routine unpacks 256 coefficients, each `w`
+// -bit wide ( s.t. w <= 8 ), into 8 -bit lanes, eight of them at a time.
+template<size_t w>
+static inline void
+unpack_u8(std::span<const uint8_t> bytes, std::span<uint8_t, N> poly)
+  requires((w >= 1) && (w <= 8))
+{
+  constexpr uint8_t mask = (1u << w) - 1;
+
+  for (size_t i = 0; i < N / 8; i++) {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes.data() + i * w, w);
+
+    for (size_t j = 0; j < 8; j++) {
+      poly[i * 8 + j] = static_cast<uint8_t>(word >> (j * w)) & mask;
+    }
+  }
+}
+
+// Given 256 coefficients a_i ( and s_i, when `sub` is set ), this routine computes
+// r_i = ((a_i - (s_i << sub_off) + rc) mod 2^16) >> off and packs lowest `w` -bits of each
+// r_i into a byte string of length w * 32, in a single pass, eight coefficients at a time,
+// so that no intermediate polynomial is materialized. Same as rounding, shifting and
+// reducing polynomial ( or vector ) step by step, before serializing it. `s` can be held
+// in any of the layouts accepted by `load_coeff`.
+template<size_t w, size_t off, bool sub, size_t sub_off, typename S>
+static inline void
+round_pack(std::span<const zq::zq_t, N> a, const S& s, const uint16_t rc, std::span<uint8_t> bytes)
+  requires((w >= 1) && (w <= 13) && (off < 16) && (sub_off < 16))
+{
+  constexpr uint16_t mask = (1u << w) - 1;
+
+  for (size_t i = 0; i < N / 8; i++) {
+    uint64_t acc = 0;
+    size_t bits = 0;
+    size_t boff = i * w;
+
+    for (size_t j = 0; j < 8; j++) {
+      const size_t k = i * 8 + j;
+
+      auto v = static_cast<uint16_t>(a[k].as_raw() + rc);
+      if constexpr (sub) {
+        v = static_cast<uint16_t>(v - (load_coeff(s, k) << sub_off));
+      }
+
+      acc |= static_cast<uint64_t>((v >> off) & mask) << bits;
+      bits += w;
+
+      while (bits >= 8) {
+        bytes[boff++] = static_cast<uint8_t>(acc);
+        acc >>= 8;
+        bits -= 8;
+      }
+    }
+  }
+}
+
+#if defined SABER_DISPATCH
+
+__extension__ typedef unsigned __int128 uint128_t;
+
+// Compile-time compute a 64 -bit mask, with lowest `w` -bits of each of four 16 -bit
+// lanes set, which is used for depositing/ extracting four coefficients at once.
+template<size_t w>
+static inline constexpr uint64_t
+lane_mask()
+{
+  constexpr uint64_t mask = (1ul << w) - 1;
+  return mask | (mask << 16) | (mask << 32) | (mask << 48);
+}
+
+// Given w bytes, this routine unpacks eight `w` -bit coefficients, by depositing bits of
+// each coefficient in its own 16 -bit lane, using BMI2 `pdep` instruction, reading ( at
+// max ) (4 * w) / 8 + 8 bytes from `src`, using two ( possibly overlapping ) 64 -bit loads.
+template<size_t w>
+SABER_TARGET_BMI2 static inline void
+unpack8_bmi2(const uint8_t* const src, zq::zq_t* const dst)
+{
+  constexpr uint64_t mask = lane_mask<w>();
+  constexpr size_t hi_off = (4 * w) / 8;
+  constexpr size_t hi_shift = (4 * w) % 8;
+
+  uint64_t lo = 0;
+  uint64_t hi = 0;
+
+  std::memcpy(&lo, src, sizeof(lo));
+  std::memcpy(&hi, src + hi_off, sizeof(hi));
+
+  lo = _pdep_u64(lo, mask);
+  hi = _pdep_u64(hi >> hi_shift, mask);
+
+  const auto dst_ptr = reinterpret_cast<uint16_t*>(dst);
+  std::memcpy(dst_ptr, &lo, sizeof(lo));
+  std::memcpy(dst_ptr + 4, &hi, sizeof(hi));
+}
+
+// Given a byte string of length w * 32, this routine unpacks 256 coefficients, each
+// `w` -bit wide, eight of them at a time, using BMI2. Last few blocks, for which 64 -bit
+// loads would read past end of byte string, are first copied to a zero-padded buffer.
+template<size_t w>
+SABER_TARGET_BMI2 static inline void
+unpack_bmi2(std::span<const uint8_t> bytes, std::span<zq::zq_t, N> poly)
+  requires((w >= 1) && (w <= 13))
+{
+  constexpr size_t reads = (4 * w) / 8 + 8;
+
+  size_t i = 0;
+  for (; i * w + reads <= N / 8 * w; i++) {
+    unpack8_bmi2<w>(bytes.data() + i * w, poly.data() + i * 8);
+  }
+
+  for (; i < N / 8; i++) {
+    std::array<uint8_t, reads> buf{};
+    std::memcpy(buf.data(), bytes.data() + i * w, w);
+    unpack8_bmi2<w>(buf.data(), poly.data() + i * 8);
+  }
+}
+
+// Compile-time compute a 64 -bit mask, with lowest `w` -bits of each of eight 8 -bit
+// lanes set, which is used for depositing eight narrow coefficients at once.
+template<size_t w>
+static inline constexpr uint64_t
+lane_mask8()
+{
+  constexpr uint64_t mask = (1ul << w) - 1;
+  return mask * 0x0101010101010101ul;
+}
+
+// Given a byte string of length w * 32, this routine unpacks 256 coefficients, each `w`
+// -bit wide ( s.t. w <= 8 ), into 8 -bit lanes, eight of them at a time, using a single
+// BMI2 `pdep` per block. Last block, for which 64 -bit load would read past end of byte
+// string, is first copied to a zero-padded buffer.
+template<size_t w>
+SABER_TARGET_BMI2 static inline void
+unpack_u8_bmi2(std::span<const uint8_t> bytes, std::span<uint8_t, N> poly)
+  requires((w >= 1) && (w <= 8))
+{
+  constexpr uint64_t mask = lane_mask8<w>();
+
+  for (size_t i = 0; i < N / 8; i++) {
+    uint64_t word = 0;
+
+    if (i * w + sizeof(word) <= N / 8 * w) {
+      std::memcpy(&word, bytes.data() + i * w, sizeof(word));
+    } else {
+      std::memcpy(&word, bytes.data() + i * w, w);
+    }
+
+    word = _pdep_u64(word, mask);
+    std::memcpy(poly.data() + i * 8, &word, sizeof(word));
+  }
+}
+
+// Given 256 coefficients, this routine packs lowest `w` -bits of each of them into a
+// byte string of length w * 32, eight of them at a time, by extracting bits from each
+// 16 -bit lane, using BMI2 `pext` instruction. Each block of w bytes is written using
+// two overlapping 64 -bit stores, when w >= 8, otherwise using a single 64 -bit store,
+// spilling into next block, which is overwritten later, except for last one.
+template<size_t w>
+SABER_TARGET_BMI2 static inline void
+pack_bmi2(std::span<const zq::zq_t, N> poly, std::span<uint8_t> bytes)
+  requires((w >= 1) && (w <= 13))
+{
+  constexpr uint64_t mask = lane_mask<w>();
+  constexpr size_t half = 4 * w;
+
+  const auto poly_ptr = reinterpret_cast<const uint16_t*>(poly.data());
+
+  for (size_t i = 0; i < N / 8; i++) {
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+
+    std::memcpy(&lo, poly_ptr + i * 8, sizeof(lo));
+    std::memcpy(&hi, poly_ptr + i * 8 + 4, sizeof(hi));
+
+    lo = _pext_u64(lo, mask);
+    hi = _pext_u64(hi, mask);
+
+    uint8_t* const dst = bytes.data() + i * w;
+
+    if constexpr (w >= 8) {
+      const uint128_t word = static_cast<uint128_t>(lo) | (static_cast<uint128_t>(hi) << half);
+      const uint64_t word_lo = static_cast<uint64_t>(word);
+      const uint64_t word_hi = static_cast<uint64_t>(word >> (8 * (w - 8)));
+
+      std::memcpy(dst, &word_lo, sizeof(word_lo));
+      std::memcpy(dst + w - 8, &word_hi, sizeof(word_hi));
+    } else {
+      const uint64_t word = lo | (hi << half);
+
+      if (i * w + 8 <= N / 8 * w) {
+        std::memcpy(dst, &word, sizeof(word));
+      } else {
+        std::memcpy(dst, &word, w);
+      }
+    }
+  }
+}
+
+// Compile-time compute byte shuffle control, for unpacking sixteen `w` -bit coefficients
+// from 2 * w bytes. Four coefficients are unpacked in each 128 -bit lane, into 32 -bit
+// elements, s.t. lane k ( of two such registers ) reads 16 bytes starting at byte offset
+// of coefficient 4k. Each element gets four consecutive bytes,
+// starting at the byte holding first bit of its coefficient.
+template<size_t w>
+static inline constexpr std::array<uint8_t, 32>
+unpack_shuffle(const size_t reg)
+{
+  std::array<uint8_t, 32> res{};
+
+  for (size_t lane = 0; lane < 2; lane++) {
+    const size_t quad = 2 * reg + lane;
+    const size_t base = (4 * quad * w) / 8;
+
+    for (size_t e = 0; e < 4; e++) {
+      const size_t boff = ((4 * quad + e) * w) / 8 - base;
+
+      for (size_t b = 0; b < 4; b++) {
+        res[lane * 16 + e * 4 + b] = static_cast<uint8_t>(boff + b);
+      }
+    }
+  }
+
+  return res;
+}
+
+// Compile-time compute right shift amount of each 32 -bit element, so that first bit of
+// its coefficient lands at bit 0, matching `unpack_shuffle`.
+template<size_t w>
+static inline constexpr std::array<uint32_t, 8>
+unpack_shifts(const size_t reg)
+{
+  std::array<uint32_t, 8> res{};
+
+  for (size_t lane = 0; lane < 2; lane++) {
+    for (size_t e = 0; e < 4; e++) {
+      res[lane * 4 + e] = static_cast<uint32_t>(((4 * (2 * reg + lane) + e) * w) % 8);
+    }
+  }
+
+  return res;
+}
+
+// Given 2 * w bytes, this routine unpacks sixteen `w` -bit coefficients into 16 -bit
+// lanes of a register, using AVX2 byte shuffle and variable shift, reading ( at max )
+// (3 * w) / 2 + 16 bytes from `src`.
+template<size_t w>
+SABER_TARGET_AVX2 static inline __m256i
+unpack16_avx2(const uint8_t* const src)
+{
+  static constexpr auto shuf0 = unpack_shuffle<w>(0);
+  static constexpr auto shuf1 = unpack_shuffle<w>(1);
+  static constexpr auto shft0 = unpack_shifts<w>(0);
+  static constexpr auto shft1 = unpack_shifts<w>(1);
+
+  const auto mask = _mm256_set1_epi32((1 << w) - 1);
+
+  // Lane k reads 16 bytes, starting at byte offset of coefficient 4k
+  const auto q0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const auto q1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (4 * w) / 8));
+  const auto q2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (8 * w) / 8));
+  const auto q3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (12 * w) / 8));
+
+  auto x0 = _mm256_inserti128_si256(_mm256_castsi128_si256(q0), q1, 1);
+  auto x1 = _mm256_inserti128_si256(_mm256_castsi128_si256(q2), q3, 1);
+
+  x0 = _mm256_shuffle_epi8(x0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shuf0.data())));
+  x1 = _mm256_shuffle_epi8(x1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shuf1.data())));
+
+  x0 = _mm256_and_si256(_mm256_srlv_epi32(x0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shft0.data()))), mask);
+  x1 = _mm256_and_si256(_mm256_srlv_epi32(x1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shft1.data()))), mask);
+
+  // Coefficients are ordered as 0..3, 8..11, 4..7, 12..15, after narrowing to 16 -bit.
+  return _mm256_permute4x64_epi64(_mm256_packus_epi32(x0, x1), 0b11011000);
+}
+
+// Given 2 * w bytes, this routine unpacks sixteen `w` -bit coefficients, see above.
+template<size_t w>
+SABER_TARGET_AVX2 static inline void
+unpack16_avx2(const uint8_t* const src, zq::zq_t* const dst)
+{
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), unpack16_avx2<w>(src));
+}
+
+// Given sixteen coefficients, held in 16 -bit lanes of a register, this routine packs
+// lowest `w` -bits of each of them into 2 * w bytes, using AVX2 multiply-add and variable
+// 64 -bit shifts, writing ( at max ) w + 16 bytes to `dst`.
+template<size_t w>
+SABER_TARGET_AVX2 static inline void
+pack16_avx2(__m256i x, uint8_t* const dst)
+{
+  constexpr int64_t half = 4 * w;
+
+  x = _mm256_and_si256(x, _mm256_set1_epi16(static_cast<short>((1 << w) - 1)));
+
+  // Each 32 -bit element holds two coefficients, in 2 * w bits
+  x = _mm256_madd_epi16(x, _mm256_set1_epi32(static_cast<int>(1u << (16 + w)) | 1));
+
+  // Each 64 -bit element holds four coefficients, in 4 * w bits
+  x = _mm256_or_si256(_mm256_and_si256(x, _mm256_set1_epi64x(0xffffffffll)), _mm256_slli_epi64(_mm256_srli_epi64(x, 32), 2 * w));
+
+  // Each 128 -bit lane holds eight coefficients, in lowest w bytes
+  const auto lo = _mm256_sllv_epi64(x, _mm256_setr_epi64x(0, half, 0, half));
+  const auto hi = _mm256_srlv_epi64(x, _mm256_setr_epi64x(64, 64 - half, 64, 64 - half));
+  const auto res = _mm256_blend_epi32(_mm256_or_si256(lo, _mm256_shuffle_epi32(lo, 0b01001110)), hi, 0b11001100);
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(res));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + w), _mm256_extracti128_si256(res, 1));
+}
+
+// Given sixteen coefficients, this routine packs lowest `w` -bits of each of them into
+// 2 * w bytes, see above.
+template<size_t w>
+SABER_TARGET_AVX2 static inline void
+pack16_avx2(const zq::zq_t* const src, uint8_t* const dst)
+{
+  pack16_avx2<w>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), dst);
+}
+
+// Given a byte string of length w * 32, this routine unpacks 256 coefficients, each
+// `w` -bit wide, sixteen of them at a time, using AVX2. Last few blocks, for which
+// vectorized loads would read past end of byte string, are first copied to a zero-padded
+// buffer.
+template<size_t w>
+SABER_TARGET_AVX2 static inline void
+unpack_avx2(std::span<const uint8_t> bytes, std::span<zq::zq_t, N> poly)
+  requires((w >= 1) && (w <= 13))
+{
+  constexpr size_t blen = 2 * w;
+  constexpr size_t reads = (3 * w) / 2 + 16;
+
+  size_t i = 0;
+  for (; i * blen + reads <= N / 8 * w; i++) {
+    unpack16_avx2<w>(bytes.data() + i * blen, poly.data() + i * 16);
+  }
+
+  for (; i < N / 16; i++) {
+    std::array<uint8_t, reads> buf{};
+    std::memcpy(buf.data(), bytes.data() + i * blen, blen);
+    unpack16_avx2<w>(buf.data(), poly.data() + i * 16);
+  }
+}
+
+// Given 256 coefficients, this routine packs lowest `w` -bits of each of them into a
+// byte string of length w * 32, sixteen of them at a time, using AVX2. Last few blocks,
+// for which vectorized stores would write past end of byte string, are first written to
+// a temporary buffer.
+template<size_t w>
+SABER_TARGET_AVX2 static inline void
+pack_avx2(std::span<const zq::zq_t, N> poly, std::span<uint8_t> bytes)
+  requires((w >= 1) && (w <= 13))
+{
+  constexpr size_t blen = 2 * w;
+  constexpr size_t writes = w + 16;
+
+  size_t i = 0;
+  for (; i * blen + writes <= N / 8 * w; i++) {
+    pack16_avx2<w>(poly.data() + i * 16, bytes.data() + i * blen);
+  }
+
+  for (; i < N / 16; i++) {
+    std::array<uint8_t, writes> buf;
+    pack16_avx2<w>(poly.data() + i * 16, buf.data());
+    std::memcpy(bytes.data() + i * blen, buf.data(), blen);
+  }
+}
+
+// Loads sixteen coefficients, starting at k-th one, of a polynomial being subtracted by
+// fused rounding kernels, into 16 -bit lanes, see `load_coeff`. 8 -bit lanes are
+// zero-extended, while bits of a bitset are broadcast and compared against per-lane masks.
+SABER_TARGET_AVX2 static inline __m256i
+load16_avx2(std::span<const zq::zq_t, N> s, const size_t k)
+{
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s.data() + k));
+}
+
+SABER_TARGET_AVX2 static inline __m256i
+load16_avx2(std::span<const uint8_t, N> s, const size_t k)
+{
+  return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s.data() + k)));
+}
+
+SABER_TARGET_AVX2 static inline __m256i
+load16_avx2(std::span<const uint8_t, N / 8> s, const size_t k)
+{
+  const auto lane_bits = _mm256_setr_epi16(1 << 0, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7, 1 << 8, 1 << 9, 1 << 10, 1 << 11, 1 << 12, 1 << 13,
+                                           1 << 14, static_cast<short>(1 << 15));
+  const auto bits = static_cast<uint16_t>(s[k / 8] | (s[k / 8 + 1] << 8));
+
+  const auto x = _mm256_and_si256(_mm256_set1_epi16(static_cast<short>(bits)), lane_bits);
+  return _mm256_srli_epi16(_mm256_cmpeq_epi16(x, lane_bits), 15);
+}
+
+// Computes (a_i - (s_i << sub_off) + rc) mod 2^16, for sixteen coefficients, starting at
+// k-th one, see `round_pack`.
+template<bool sub, size_t sub_off, typename S>
+SABER_TARGET_AVX2 static inline __m256i
+round16_avx2(std::span<const zq::zq_t, N> a, const S& s, const __m256i vrc, const size_t k)
+{
+  auto x = _mm256_add_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data() + k)), vrc);
+  if constexpr (sub) {
+    x = _mm256_sub_epi16(x, _mm256_slli_epi16(load16_avx2(s, k), sub_off));
+  }
+  return x;
+}
+
+// Fused rounding and packing of 256 coefficients, same as `round_pack`, but sixteen
+// coefficients are rounded, shifted and packed at a time, using AVX2. Last few blocks,
+// for which vectorized stores would write past end of byte string, are first written to
+// a temporary buffer. When w = 1 ( i.e. decrypted message ), bit `off` of thirty two
+// coefficients is moved to sign bit of 8 -bit lanes and collected using a single
+// `movemask`.
+template<size_t w, size_t off, bool sub, size_t sub_off, typename S>
+SABER_TARGET_AVX2 static inline void
+round_pack_avx2(std::span<const zq::zq_t, N> a, const S& s, const uint16_t rc, std::span<uint8_t> bytes)
+  requires((w >= 1) && (w <= 13) && (off < 16) && (sub_off < 16))
+{
+  const auto vrc = _mm256_set1_epi16(static_cast<short>(rc));
+
+  if constexpr (w == 1) {
+    for (size_t i = 0; i < N / 32; i++) {
+      const auto lo = _mm256_slli_epi16(round16_avx2<sub, sub_off>(a, s, vrc, i * 32), 15 - off);
+      const auto hi = _mm256_slli_epi16(round16_avx2<sub, sub_off>(a, s, vrc, i * 32 + 16), 15 - off);
+
+      // Saturating narrowing keeps sign, but interleaves 64 -bit halves of lo and hi
+      const auto x = _mm256_permute4x64_epi64(_mm256_packs_epi16(lo, hi), 0b11011000);
+      const auto word = static_cast<uint32_t>(_mm256_movemask_epi8(x));
+
+      std::memcpy(bytes.data() + i * sizeof(word), &word, sizeof(word));
+    }
+  } else {
+    constexpr size_t blen = 2 * w;
+    constexpr size_t writes = w + 16;
+
+    for (size_t i = 0; i < N / 16; i++) {
+      const auto x = _mm256_srli_epi16(round16_avx2<sub, sub_off>(a, s, vrc, i * 16), off);
+
+      if (i * blen + writes <= N / 8 * w) {
+        pack16_avx2<w>(x, bytes.data() + i * blen);
+      } else {
+        std::array<uint8_t, writes> buf;
+        pack16_avx2<w>(x, buf.data());
+        std::memcpy(bytes.data() + i * blen, buf.data(), blen);
+      }
+    }
+  }
+}
+
+#endif
+
+}
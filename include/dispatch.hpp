@@ -0,0 +1,112 @@
+#pragma once
+#include <cstdint>
+
+#if (defined __x86_64__ || defined __i386__) && (defined __GNUC__ || defined __clang__)
+
+// Instruction set specific variants are compiled and selected at runtime.
+#define SABER_DISPATCH
+
+// Enables AVX2 for a function and inlines everything it calls, so that portable
+// implementation of a kernel gets vectorized for AVX2, when wrapped in such a function.
+#define SABER_TARGET_AVX2 __attribute__((target("avx2"), flatten))
+
+// Same as above, but enables AVX-512 ( foundation, byte/ word and vector length
+// extensions ) on top of AVX2.
+#define SABER_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw,avx512vl"), flatten))
+
+// Enables BMI2 ( bit deposit/ extract ) for a function.
+#define SABER_TARGET_BMI2 __attribute__((target("bmi2")))
+
+#endif
+
+// Runtime selection of instruction set specific variants of hot kernels, so that one
+// binary, built for baseline target ( say -march=x86-64 ), still runs vectorized code on
+// CPUs supporting AVX2 or AVX-512, while falling back to portable implementation on
+// others. Variants are compiled from same source, by enabling wider instruction set only
+// for those functions, using `SABER_TARGET_*` attributes.
+namespace dispatch {
+
+// Instruction set extensions, for which kernel variants exist, in increasing order of
+// capability.
+enum class isa_t : uint8_t
+{
+  generic = 0,
+  avx2 = 1,
+  avx512 = 2
+};
+
+// Queries CPU for supported instruction set extensions, returning most capable one, for
+// which kernel variants exist.
+static inline isa_t
+detect()
+{
+#if defined SABER_DISPATCH
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl")) {
+    return isa_t::avx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return isa_t::avx2;
+  }
+#endif
+
+  return isa_t::generic;
+}
+
+// Queries CPU for BMI2 support, which is orthogonal to vector instruction set extensions.
+// Note, BMI2 bit deposit/ extract instructions are microcoded ( i.e. very slow ) on AMD
+// CPUs prior to Zen 3, so BMI2 is reported as unsupported on them.
+static inline bool
+detect_bmi2()
+{
+#if defined SABER_DISPATCH
+  __builtin_cpu_init();
+
+  const bool slow = __builtin_cpu_is("bdver4") || __builtin_cpu_is("znver1") || __builtin_cpu_is("znver2");
+  return __builtin_cpu_supports("bmi2") && !slow;
+#else
+  return false;
+#endif
+}
+
+// Instruction set extensions, selected only once, during program startup. Note, if any of
+// these is read during initialization of some other static object, before itself being
+// initialized, it's zero i.e. `isa_t::generic` or false, which is always safe to use.
+inline const isa_t ISA = detect();
+inline const bool BMI2 = detect_bmi2();
+
+// Returns truth value if AVX2 variants of kernels can be executed. When compiling for a
+// target, which already guarantees AVX2 support, it's decided at compile-time.
+static inline bool
+has_avx2()
+{
+#if defined __AVX2__
+  return true;
+#else
+  return ISA >= isa_t::avx2;
+#endif
+}
+
+// Returns truth value if AVX-512 variants of kernels can be executed. When compiling for
+// a target, which already guarantees AVX-512 support, it's decided at compile-time.
+static inline bool
+has_avx512()
+{
+#if defined __AVX512F__ && defined __AVX512BW__ && defined __AVX512VL__
+  return true;
+#else
+  return ISA >= isa_t::avx512;
+#endif
+}
+
+// Returns truth value if BMI2 variants of kernels can be executed, and are fast. Unlike
+// above, it's always decided at runtime, because a target guaranteeing BMI2 support (
+// say -march=znver2 ) doesn't guarantee it to be fast.
+static inline bool
+has_bmi2()
+{
+  return BMI2;
+}
+
+}
@@ -45,6 +45,19 @@ encaps(std::span<const uint8_t, keyBytes> m, std::span<const uint8_t, PK_LEN> pk
   _saber_kem::encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(m, pkey, ctxt, seskey);
 }
 
+// FireSaber KEM public key, prepared for repeated encapsulation against it, see
+// `_saber_kem::prepared_pkey_t`. Build it once, from 1312 -bytes public key, when
+// encapsulating many times to same peer.
+using prepared_pkey_t = _saber_kem::prepared_pkey_t<L, EQ, EP, seedBytes>;
+
+// Same as above, but encapsulates against a prepared public key, skipping expansion,
+// unpacking and hashing of public key.
+inline void
+encaps(std::span<const uint8_t, keyBytes> m, const prepared_pkey_t& pkey, std::span<uint8_t, CT_LEN> ctxt, std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+{
+  _saber_kem::encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(m, pkey, ctxt, seskey);
+}
+
 // Given 1472 -bytes cipher text and 3040 -bytes FireSaber KEM secret key, this routine
 // can be used for decapsulating the cipher text, deriving 32 -bytes session key.
 inline void
@@ -53,4 +66,54 @@ decaps(std::span<const uint8_t, CT_LEN> ctxt, std::span<const uint8_t, SK_LEN> s
   _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(ctxt, skey, seskey);
 }
 
+// FireSaber KEM secret key, prepared for repeated decapsulation under it, see
+// `_saber_kem::prepared_skey_t`. Build it once, from 3040 -bytes secret key, when
+// decapsulating many times under same static key.
+using prepared_skey_t = _saber_kem::prepared_skey_t<L, EQ, EP, seedBytes, keyBytes>;
+
+// Same as above, but decapsulates under a prepared secret key, skipping unpacking and
+// expansion of secret key components.
+inline void
+decaps(std::span<const uint8_t, CT_LEN> ctxt, const prepared_skey_t& skey, std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+{
+  _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(ctxt, skey, seskey);
+}
+
+// Batched variant of `keygen`, generating n -many FireSaber KEM keypairs, i-th one from
+// i-th 32 -bytes `seedA`, `seedS` and `z`, s.t. all inputs and outputs are laid out
+// contiguously, see `_saber_kem::keygen_batch`.
+template<size_t n>
+inline void
+keygen_batch(std::span<const uint8_t, n * seedBytes> seedA,
+             std::span<const uint8_t, n * noiseBytes> seedS,
+             std::span<const uint8_t, n * keyBytes> z,
+             std::span<uint8_t, n * PK_LEN> pkey,
+             std::span<uint8_t, n * SK_LEN> skey)
+{
+  _saber_kem::keygen_batch<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling, n>(seedA, seedS, z, pkey, skey);
+}
+
+// Batched variant of `encaps`, encapsulating i-th 32 -bytes `m` against i-th FireSaber KEM
+// public key, for all i ∈ [0, n), s.t. all inputs and outputs are laid out contiguously,
+// see `_saber_kem::encaps_batch`.
+template<size_t n>
+inline void
+encaps_batch(std::span<const uint8_t, n * keyBytes> m,
+             std::span<const uint8_t, n * PK_LEN> pkey,
+             std::span<uint8_t, n * CT_LEN> ctxt,
+             std::span<uint8_t, n * sha3_256::DIGEST_LEN> seskey)
+{
+  _saber_kem::encaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, n>(m, pkey, ctxt, seskey);
+}
+
+// Batched variant of `decaps`, decapsulating i-th cipher text under i-th FireSaber KEM
+// secret key, for all i ∈ [0, n), s.t. all inputs and outputs are laid out contiguously,
+// see `_saber_kem::decaps_batch`.
+template<size_t n>
+inline void
+decaps_batch(std::span<const uint8_t, n * CT_LEN> ctxt, std::span<const uint8_t, n * SK_LEN> skey, std::span<uint8_t, n * sha3_256::DIGEST_LEN> seskey)
+{
+  _saber_kem::decaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, n>(ctxt, skey, seskey);
+}
+
 }
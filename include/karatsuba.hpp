@@ -1,56 +1,198 @@
 #pragma once
 #include "params.hpp"
+#include "schoolbook.hpp"
 #include "zq.hpp"
+#include <algorithm>
 #include <array>
+#include <span>
+
+// Polynomials of degree < `SABER_KARATSUBA_CUTOFF` are multiplied using schoolbook
+// algorithm, instead of recursing further. Must be a power of 2, can be overridden in
+// compile-time.
+#if !defined SABER_KARATSUBA_CUTOFF
+#define SABER_KARATSUBA_CUTOFF 32
+#endif
 
 // Karatsuba Multiplication of two Polynomials
 namespace karatsuba {
 
+// Recursion cut-off, below which ( i.e. when N <= CUTOFF ) schoolbook multiplication is
+// used.
+constexpr size_t CUTOFF = SABER_KARATSUBA_CUTOFF;
+
+// Number of Zq coefficients of scratch space, required by Karatsuba multiplication of
+// two polynomials of degree N-1, when recursion stops at `cutoff`. Each level of
+// recursion uses 2*N coefficients for holding sums of lower and upper halves and their
+// product, while rest of scratch space is shared by its ( sequentially executed )
+// recursive calls.
+template<size_t N, size_t cutoff = CUTOFF>
+static inline consteval size_t
+scratch_len()
+{
+  if constexpr (N <= cutoff) {
+    return 0;
+  } else {
+    return 2 * N + scratch_len<N / 2, cutoff>();
+  }
+}
+
+// Multiplies polynomials at leaves of Karatsuba recursion, using schoolbook algorithm.
+// Any other leaf multiplier must expose same static member function template.
+struct schoolbook_leaf_t
+{
+  template<size_t N>
+  static inline constexpr void mul(std::span<const zq::zq_t, N> polya, std::span<const zq::zq_t, N> polyb, std::span<zq::zq_t, 2 * N> polyab)
+  {
+    std::fill(polyab.begin(), polyab.end(), zq::zq_t());
+    schoolbook::mul_acc<N>(polya, polyb, polyab);
+  }
+};
+
 // Given two polynomials of degree N-1 ( s.t. N is power of 2 and N >= 1), this
 // routine multiplies them using Karatsuba algorithm, following
 // https://github.com/itzmeanjan/falcon/blob/cce934dcd092c95808c0bdaeb034312ee7754d7e/include/karatsuba.hpp,
-// computing resulting polynomial of degree 2*N - 1
-template<size_t N>
+// writing resulting polynomial of degree 2*N - 1 to `polyab`. Recursion stops as soon as
+// N <= `cutoff`, where `leaf_t` ( by default, schoolbook ) multiplication takes over.
+//
+// Halves of input polynomials are never copied, products of lower and upper halves are
+// computed in-place in `polyab`, while all other intermediates live in caller-provided
+// `scratch`, so that neither any per-level copy is made nor stack usage grows with
+// recursion depth.
+template<size_t N, size_t cutoff = CUTOFF, typename leaf_t = schoolbook_leaf_t>
+static inline constexpr void
+karatsuba(std::span<const zq::zq_t, N> polya,
+          std::span<const zq::zq_t, N> polyb,
+          std::span<zq::zq_t, 2 * N> polyab,
+          std::span<zq::zq_t, scratch_len<N, cutoff>()> scratch)
+  requires(saber_params::is_power_of_2(N) && saber_params::is_power_of_2(cutoff) && (cutoff > 0))
+{
+  if constexpr (N <= cutoff) {
+    leaf_t::template mul<N>(polya, polyb, polyab);
+  } else {
+    constexpr size_t Nby2 = N / 2;
+
+    auto polyax = scratch.template subspan<0, Nby2>();
+    auto polybx = scratch.template subspan<Nby2, Nby2>();
+    auto polyaxbx = scratch.template subspan<N, N>();
+    auto rest = scratch.template subspan<2 * N>();
+
+    for (size_t i = 0; i < Nby2; i++) {
+      polyax[i] = polya[i] + polya[Nby2 + i];
+      polybx[i] = polyb[i] + polyb[Nby2 + i];
+    }
+
+    karatsuba<Nby2, cutoff, leaf_t>(polya.template first<Nby2>(), polyb.template first<Nby2>(), polyab.template first<N>(), rest);
+    karatsuba<Nby2, cutoff, leaf_t>(polya.template last<Nby2>(), polyb.template last<Nby2>(), polyab.template last<N>(), rest);
+    karatsuba<Nby2, cutoff, leaf_t>(polyax, polybx, polyaxbx, rest);
+
+    for (size_t i = 0; i < N; i++) {
+      polyaxbx[i] = polyaxbx[i] - zq::zq_t(polyab[i] + polyab[N + i]);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      polyab[Nby2 + i] = polyab[Nby2 + i] + polyaxbx[i];
+    }
+  }
+}
+
+// Given two polynomials of degree N-1 ( s.t. N is power of 2 and N >= 1), this
+// routine multiplies them using Karatsuba algorithm, computing resulting polynomial of
+// degree 2*N - 1, using scratch space of `scratch_len()` coefficients, allocated on
+// stack.
+template<size_t N, size_t cutoff = CUTOFF>
 static inline constexpr std::array<zq::zq_t, 2 * N>
 karatsuba(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& polyb)
-  requires(saber_params::is_power_of_2(N))
+  requires(saber_params::is_power_of_2(N) && saber_params::is_power_of_2(cutoff) && (cutoff > 0))
+{
+  std::array<zq::zq_t, 2 * N> polyab;
+  zq::uninit_t<std::array<zq::zq_t, scratch_len<N, cutoff>()>> scratch;
+
+  karatsuba<N, cutoff>(polya, polyb, polyab, scratch.v);
+  return polyab;
+}
+
+// Number of coefficients in each piece, a polynomial of degree N-1 is split into, when
+// Karatsuba recursion is unrolled till `cutoff`.
+template<size_t N, size_t cutoff = CUTOFF>
+static inline consteval size_t
+piece_len()
+{
+  return std::min(N, cutoff);
+}
+
+// Number of pieces, a polynomial of degree N-1 is evaluated into, when Karatsuba
+// recursion is unrolled till `cutoff` i.e. 3 ^ log2(N / cutoff).
+template<size_t N, size_t cutoff = CUTOFF>
+static inline consteval size_t
+eval_count()
 {
-  if constexpr (N == 1) {
-    return { zq::zq_t(polya[0] * polyb[0]), zq::zq_t(0) };
+  if constexpr (N <= cutoff) {
+    return 1;
+  } else {
+    return 3 * eval_count<N / 2, cutoff>();
+  }
+}
+
+// Given a polynomial of degree N-1 ( s.t. N is power of 2 and N >= 1 ), this routine
+// unrolls the splitting step of Karatsuba recursion, writing all pieces, which are to be
+// multiplied using schoolbook algorithm, to `pieces`. Point-wise products of such
+// evaluations can be accumulated, before interpolating them back only once, see
+// `interpolate`.
+template<size_t N, size_t cutoff = CUTOFF>
+static inline constexpr void
+evaluate(const std::array<zq::zq_t, N>& poly, std::span<std::array<zq::zq_t, piece_len<N, cutoff>()>, eval_count<N, cutoff>()> pieces)
+  requires(saber_params::is_power_of_2(N) && saber_params::is_power_of_2(cutoff) && (cutoff > 0))
+{
+  if constexpr (N <= cutoff) {
+    pieces[0] = poly;
   } else {
     constexpr size_t Nby2 = N / 2;
+    constexpr size_t cnt = eval_count<Nby2, cutoff>();
 
-    std::array<zq::zq_t, Nby2> polya0;
-    std::array<zq::zq_t, Nby2> polya1;
-    std::array<zq::zq_t, Nby2> polyb0;
-    std::array<zq::zq_t, Nby2> polyb1;
-    std::array<zq::zq_t, Nby2> polyax;
-    std::array<zq::zq_t, Nby2> polybx;
+    zq::uninit_t<std::array<zq::zq_t, Nby2>> buf0, buf1, bufx;
+    auto& poly0 = buf0.v;
+    auto& poly1 = buf1.v;
+    auto& polyx = bufx.v;
 
     for (size_t i = 0; i < Nby2; i++) {
-      polya0[i] = polya[i];
-      polya1[i] = polya[Nby2 + i];
+      poly0[i] = poly[i];
+      poly1[i] = poly[Nby2 + i];
+      polyx[i] = poly[i] + poly[Nby2 + i];
+    }
 
-      polyb0[i] = polyb[i];
-      polyb1[i] = polyb[Nby2 + i];
+    evaluate<Nby2, cutoff>(poly0, pieces.template subspan<0 * cnt, cnt>());
+    evaluate<Nby2, cutoff>(poly1, pieces.template subspan<1 * cnt, cnt>());
+    evaluate<Nby2, cutoff>(polyx, pieces.template subspan<2 * cnt, cnt>());
+  }
+}
 
-      polyax[i] = polya[i] + polya[Nby2 + i];
-      polybx[i] = polyb[i] + polyb[Nby2 + i];
-    }
+// Given (sums of) point-wise products of pieces, produced by `evaluate`, this routine
+// interpolates them back to a polynomial of degree 2*N - 1, by unrolling the combining
+// step of Karatsuba recursion.
+template<size_t N, size_t cutoff = CUTOFF>
+static inline constexpr std::array<zq::zq_t, 2 * N>
+interpolate(std::span<const std::array<zq::zq_t, 2 * piece_len<N, cutoff>()>, eval_count<N, cutoff>()> prods)
+  requires(saber_params::is_power_of_2(N) && saber_params::is_power_of_2(cutoff) && (cutoff > 0))
+{
+  if constexpr (N <= cutoff) {
+    return prods[0];
+  } else {
+    constexpr size_t Nby2 = N / 2;
+    constexpr size_t cnt = eval_count<Nby2, cutoff>();
 
-    const std::array<zq::zq_t, N> polya0b0 = karatsuba<Nby2>(polya0, polyb0);
-    const std::array<zq::zq_t, N> polya1b1 = karatsuba<Nby2>(polya1, polyb1);
-    std::array<zq::zq_t, N> polyaxbx = karatsuba<Nby2>(polyax, polybx);
+    const std::array<zq::zq_t, N> poly0 = interpolate<Nby2, cutoff>(prods.template subspan<0 * cnt, cnt>());
+    const std::array<zq::zq_t, N> poly1 = interpolate<Nby2, cutoff>(prods.template subspan<1 * cnt, cnt>());
+    std::array<zq::zq_t, N> polyx = interpolate<Nby2, cutoff>(prods.template subspan<2 * cnt, cnt>());
 
     for (size_t i = 0; i < N; i++) {
-      polyaxbx[i] = polyaxbx[i] - zq::zq_t(polya0b0[i] + polya1b1[i]);
+      polyx[i] = polyx[i] - zq::zq_t(poly0[i] + poly1[i]);
     }
 
     std::array<zq::zq_t, 2 * N> polyab{};
     for (size_t i = 0; i < N; i++) {
-      polyab[i] = polyab[i] + polya0b0[i];
-      polyab[N + i] = polyab[N + i] + polya1b1[i];
-      polyab[Nby2 + i] = polyab[Nby2 + i] + polyaxbx[i];
+      polyab[i] = polyab[i] + poly0[i];
+      polyab[N + i] = polyab[N + i] + poly1[i];
+      polyab[Nby2 + i] = polyab[Nby2 + i] + polyx[i];
     }
 
     return polyab;
@@ -67,7 +209,7 @@ karamul(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& pol
 {
   const std::array<zq::zq_t, 2 * N> polyab = karatsuba(polya, polyb);
 
-  std::array<zq::zq_t, N> res{};
+  std::array<zq::zq_t, N> res;
   for (size_t i = 0; i < N; i++) {
     res[i] = polyab[i] - polyab[N + i];
   }
@@ -0,0 +1,357 @@
+#pragma once
+#include "dispatch.hpp"
+#include "utils.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+// Multi-buffer Keccak-f[1600] permutation and sponge, driving `lanes` -many independent
+// instances of same hash function ( say SHAKE128 ) in lockstep, one instance per SIMD lane.
+namespace keccak_batch {
+
+// Default number of instances hashed at once s.t. each lane holds a 64 -bit word of a
+// 256 -bit register. Any other lane count ( say 8, for targets with 512 -bit registers,
+// or 2, for interleaving independent hashes of a single operation ) can be requested.
+constexpr size_t LANES = 4;
+
+// Number of rounds of Keccak-f[1600] permutation.
+constexpr size_t ROUNDS = 24;
+
+// Round constants, XOR-ed into lane (0, 0) by iota step.
+constexpr std::array<uint64_t, ROUNDS> RC{
+  0x0000000000000001ul, 0x0000000000008082ul, 0x800000000000808aul, 0x8000000080008000ul, 0x000000000000808bul, 0x0000000080000001ul,
+  0x8000000080008081ul, 0x8000000000008009ul, 0x000000000000008aul, 0x0000000000000088ul, 0x0000000080008009ul, 0x000000008000000aul,
+  0x000000008000808bul, 0x800000000000008bul, 0x8000000000008089ul, 0x8000000000008003ul, 0x8000000000008002ul, 0x8000000000000080ul,
+  0x000000000000800aul, 0x800000008000000aul, 0x8000000080008081ul, 0x8000000000008080ul, 0x0000000080000001ul, 0x8000000080008008ul
+};
+
+// Rotation offsets, applied by rho step, on lane (x, y), indexed by x + 5 * y.
+constexpr std::array<size_t, 25> RHO{ 0, 1, 62, 28, 27, 36, 44, 6, 55, 20, 3, 10, 43, 25, 39, 41, 45, 15, 21, 8, 18, 2, 61, 56, 14 };
+
+// Destination of lane (x, y), after pi step, indexed by x + 5 * y, s.t. lane (x, y) moves
+// to (y, 2x + 3y).
+constexpr std::array<size_t, 25> PI = []() {
+  std::array<size_t, 25> res{};
+  for (size_t y = 0; y < 5; y++) {
+    for (size_t x = 0; x < 5; x++) {
+      res[x + 5 * y] = y + 5 * ((2 * x + 3 * y) % 5);
+    }
+  }
+  return res;
+}();
+
+// 64 -bit word at same position of `lanes` -many independent Keccak states.
+template<size_t lanes>
+using lane_t = std::array<uint64_t, lanes>;
+
+// `lanes` -many independent Keccak states, in word-major layout i.e. all lanes of i-th
+// word are contiguous, so that each step of the permutation maps to element-wise SIMD
+// operation over them.
+template<size_t lanes>
+using state_t = std::array<lane_t<lanes>, 25>;
+
+// Same as `lane_t`, but as a vector type, over which bitwise operators ( and shifts by a
+// scalar ) apply element-wise, so that the compiler maps each of them to one SIMD
+// instruction ( or a few, when `lanes` words don't fit in one register ), instead of
+// having to vectorize loops over lanes. Rotation, written as pair of shifts, is lowered to
+// `vprolq`, when AVX-512 is enabled.
+// Note, vector attribute is ignored on alias templates, hence the wrapping struct.
+template<size_t lanes>
+struct vec_t
+{
+  typedef uint64_t type __attribute__((vector_size(sizeof(uint64_t) * lanes)));
+};
+
+// Given `lanes` -many Keccak states, this routine applies Keccak-f[1600] permutation on
+// each of them. Each state word is loaded into a vector of `lanes` words, so that all
+// instances are permuted by same sequence of instructions.
+template<size_t lanes>
+static inline void
+permute_generic(state_t<lanes>& state)
+{
+  using vec = typename vec_t<lanes>::type;
+
+  vec a[25];
+  std::memcpy(a, state.data(), sizeof(a));
+
+  for (size_t r = 0; r < ROUNDS; r++) {
+    // theta
+    vec c[5];
+    for (size_t x = 0; x < 5; x++) {
+      c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+    }
+
+    vec d[5];
+    for (size_t x = 0; x < 5; x++) {
+      const vec t = c[(x + 1) % 5];
+      d[x] = c[(x + 4) % 5] ^ ((t << 1) | (t >> 63));
+    }
+
+    // theta ( application ), rho and pi
+    vec b[25];
+    for (size_t y = 0; y < 5; y++) {
+      for (size_t x = 0; x < 5; x++) {
+        const size_t i = x + 5 * y;
+        const vec t = a[i] ^ d[x];
+        b[PI[i]] = (t << RHO[i]) | (t >> ((64 - RHO[i]) % 64));
+      }
+    }
+
+    // chi
+    for (size_t y = 0; y < 25; y += 5) {
+      for (size_t x = 0; x < 5; x++) {
+        a[x + y] = b[x + y] ^ (~b[(x + 1) % 5 + y] & b[(x + 2) % 5 + y]);
+      }
+    }
+
+    // iota
+    a[0] ^= RC[r];
+  }
+
+  std::memcpy(state.data(), a, sizeof(a));
+}
+
+#if defined SABER_DISPATCH
+
+// Keccak-f[1600] permutation of `lanes` -many states, vectorized for AVX2.
+template<size_t lanes>
+SABER_TARGET_AVX2 static inline void
+permute_avx2(state_t<lanes>& state)
+{
+  permute_generic<lanes>(state);
+}
+
+// Keccak-f[1600] permutation of `lanes` -many states, vectorized for AVX-512, which also
+// offers lane rotation and three-input logic instructions.
+template<size_t lanes>
+SABER_TARGET_AVX512 static inline void
+permute_avx512(state_t<lanes>& state)
+{
+  permute_generic<lanes>(state);
+}
+
+#endif
+
+// Keccak-f[1600] permutation of `lanes` -many states, using most capable instruction set
+// extension, supported by the CPU.
+template<size_t lanes>
+static inline void
+permute(state_t<lanes>& state)
+{
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx512()) {
+    permute_avx512<lanes>(state);
+    return;
+  }
+  if (dispatch::has_avx2()) {
+    permute_avx2<lanes>(state);
+    return;
+  }
+#endif
+
+  permute_generic<lanes>(state);
+}
+
+// Keccak sponge of `rate` -bytes, with domain separator `ds`, driving `lanes` -many
+// independent instances in lockstep. Messages absorbed by ( and outputs squeezed from )
+// all instances, in a single call, must be of same length, so that each of them pads and
+// permutes at same time, which is how a batch of Saber operations uses SHAKE128/ SHA3.
+template<size_t rate, uint8_t ds, size_t lanes>
+  requires((rate % 8 == 0) && (rate < 200) && std::has_single_bit(lanes))
+struct sponge_t
+{
+private:
+  alignas(64) state_t<lanes> state{};
+  size_t offset = 0;
+  bool finalized = false;
+
+public:
+  // Absorbs i-th message into i-th instance, for all i ∈ [0, lanes). All messages must be
+  // of same length, see `hash` for messages of different lengths. Can be called any
+  // number of times, before sponge is finalized.
+  inline void absorb(std::array<std::span<const uint8_t>, lanes> msgs)
+  {
+    if (finalized) {
+      return;
+    }
+
+    const size_t mlen = msgs[0].size();
+    assert(std::all_of(msgs.begin(), msgs.end(), [&](const auto& msg) { return msg.size() == mlen; }));
+
+    size_t i = 0;
+    while (i < mlen) {
+      if ((offset % 8 == 0) && (mlen - i >= 8)) {
+        for (size_t k = 0; k < lanes; k++) {
+          state[offset / 8][k] ^= saber_utils::from_le_bytes<uint64_t>(msgs[k].subspan(i, 8));
+        }
+        offset += 8;
+        i += 8;
+      } else {
+        const size_t shift = (offset % 8) * 8;
+        for (size_t k = 0; k < lanes; k++) {
+          state[offset / 8][k] ^= static_cast<uint64_t>(msgs[k][i]) << shift;
+        }
+        offset += 1;
+        i += 1;
+      }
+
+      if (offset == rate) {
+        permute<lanes>(state);
+        offset = 0;
+      }
+    }
+  }
+
+  // Pads all instances, after which no more message bytes can be absorbed.
+  inline void finalize()
+  {
+    if (finalized) {
+      return;
+    }
+
+    for (size_t k = 0; k < lanes; k++) {
+      state[offset / 8][k] ^= static_cast<uint64_t>(ds) << ((offset % 8) * 8);
+      state[(rate - 1) / 8][k] ^= 0x80ul << 56;
+    }
+
+    permute<lanes>(state);
+    offset = 0;
+    finalized = true;
+  }
+
+  // Squeezes i-th output out of i-th instance, for all i ∈ [0, lanes). All outputs must
+  // be of same length. Can be called any number of times, after sponge is finalized.
+  inline void squeeze(std::array<std::span<uint8_t>, lanes> outs)
+  {
+    if (!finalized) {
+      return;
+    }
+
+    const size_t olen = outs[0].size();
+    assert(std::all_of(outs.begin(), outs.end(), [&](const auto& out) { return out.size() == olen; }));
+
+    size_t i = 0;
+    while (i < olen) {
+      if (offset == rate) {
+        permute<lanes>(state);
+        offset = 0;
+      }
+
+      if ((offset % 8 == 0) && (olen - i >= 8)) {
+        for (size_t k = 0; k < lanes; k++) {
+          const uint64_t word = state[offset / 8][k];
+          for (size_t b = 0; b < 8; b++) {
+            outs[k][i + b] = static_cast<uint8_t>(word >> (b * 8));
+          }
+        }
+        offset += 8;
+        i += 8;
+      } else {
+        const size_t shift = (offset % 8) * 8;
+        for (size_t k = 0; k < lanes; k++) {
+          outs[k][i] = static_cast<uint8_t>(state[offset / 8][k] >> shift);
+        }
+        offset += 1;
+        i += 1;
+      }
+    }
+  }
+
+  // Given `lanes` -many messages of arbitrary ( possibly different ) lengths, this routine
+  // absorbs, pads and squeezes i-th output ( all of same length ) out of i-th instance,
+  // all at once. Messages are aligned at their end i.e. a shorter message starts being
+  // absorbed only when the longest one is left with as many blocks as it has, till then
+  // its instance is kept zeroed, so that all of them finish absorbing at same time.
+  inline static void hash(std::array<std::span<const uint8_t>, lanes> msgs, std::array<std::span<uint8_t>, lanes> outs)
+  {
+    sponge_t sponge;
+
+    std::array<size_t, lanes> blocks;
+    size_t max_blocks = 0;
+
+    for (size_t k = 0; k < lanes; k++) {
+      blocks[k] = msgs[k].size() / rate + 1;
+      max_blocks = std::max(max_blocks, blocks[k]);
+    }
+
+    std::array<uint8_t, rate> padded;
+
+    for (size_t b = 0; b < max_blocks; b++) {
+      for (size_t k = 0; k < lanes; k++) {
+        const size_t skip = max_blocks - blocks[k];
+
+        if (b <= skip) {
+          for (size_t i = 0; i < 25; i++) {
+            sponge.state[i][k] = 0;
+          }
+        }
+        if (b < skip) {
+          continue;
+        }
+
+        const size_t off = (b - skip) * rate;
+        auto block = msgs[k].subspan(off, std::min(rate, msgs[k].size() - off));
+
+        if (block.size() < rate) {
+          std::fill(padded.begin(), padded.end(), 0);
+          std::copy(block.begin(), block.end(), padded.begin());
+          padded[block.size()] ^= ds;
+          padded[rate - 1] ^= 0x80;
+
+          block = padded;
+        }
+
+        for (size_t i = 0; i < rate / 8; i++) {
+          sponge.state[i][k] ^= saber_utils::from_le_bytes<uint64_t>(block.subspan(i * 8, 8));
+        }
+      }
+
+      permute<lanes>(sponge.state);
+    }
+
+    sponge.finalized = true;
+    sponge.squeeze(outs);
+  }
+
+  // Resets sponge, so that it can be used for hashing another batch of messages.
+  inline void reset()
+  {
+    state = {};
+    offset = 0;
+    finalized = false;
+  }
+};
+
+// Given a byte string holding `lanes` -many records, each of `stride` -bytes, laid out
+// contiguously, this routine returns views of `len` -bytes, starting at offset `off` of
+// each record, in form accepted by multi-buffer sponge ( and batched routines built on
+// top of it ).
+template<size_t lanes, typename T, size_t extent>
+static inline std::array<std::span<T>, lanes>
+split(std::span<T, extent> bytes, const size_t stride, const size_t off, const size_t len)
+{
+  std::array<std::span<T>, lanes> res;
+  for (size_t k = 0; k < lanes; k++) {
+    res[k] = bytes.subspan(k * stride + off, len);
+  }
+  return res;
+}
+
+// SHAKE128 Xof, over `lanes` -many instances.
+template<size_t lanes = LANES>
+using shake128_t = sponge_t<168, 0x1f, lanes>;
+
+// SHA3-256 hash function, over `lanes` -many instances.
+template<size_t lanes = LANES>
+using sha3_256_t = sponge_t<136, 0x06, lanes>;
+
+// SHA3-512 hash function, over `lanes` -many instances.
+template<size_t lanes = LANES>
+using sha3_512_t = sponge_t<72, 0x06, lanes>;
+
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "keccak_batch.hpp"
 #include "params.hpp"
 #include "pke.hpp"
 #include "sha3_256.hpp"
@@ -49,35 +50,46 @@ keygen(std::span<const uint8_t, seedBytes> seedA,
   std::memcpy(sk_z.data(), z.data(), z.size());
 }
 
-// Given keyBytes input `m` ( random sampled ) and Saber KEM public key, this routine
-// can be used for generating a session key ( of 32 -bytes ) and Saber KEM cipher text.
-// This is an implementation of algorithm 21 in section 8.5.2 of Saber spec.
-template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling>
+// Saber KEM public key, prepared for repeated encapsulation against it i.e. matrix A (
+// expanded from seedA ) and vector b ( unpacked from public key ), both in evaluation
+// domain of polynomial multiplier, along with SHA3-256 digest of public key, are computed
+// only once, so that each encapsulation is left with only the work depending on fresh
+// message. Meant to be built once for a long-lived peer public key.
+template<size_t L, size_t EQ, size_t EP, size_t seedBytes>
+struct prepared_pkey_t
+{
+  saber_pke::pkey_eval_t<L, EQ, EP, seedBytes> pke;
+  std::array<uint8_t, sha3_256::DIGEST_LEN> hashed_pk;
+
+  // Given a Saber KEM public key, this routine expands, unpacks and hashes it.
+  inline explicit prepared_pkey_t(std::span<const uint8_t, saber_utils::kem_pklen<L, EP, seedBytes>()> pkey)
+    : pke(pkey)
+  {
+    sha3_256::sha3_256_t h256;
+    h256.absorb(pkey);
+    h256.finalize();
+    h256.digest(hashed_pk);
+    h256.reset();
+  }
+};
+
+// Given SHA3-256 digest of keyBytes input `m` ( random sampled ), Saber PKE public key (
+// see `saber_pke::encrypt` for accepted forms ) and SHA3-256 digest of Saber KEM public
+// key, this routine generates a session key ( of 32 -bytes ) and Saber KEM cipher text.
+// This is an implementation of algorithm 21 in section 8.5.2 of Saber spec, where step 2
+// and 3 are already done by caller.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling, typename PK>
 inline void
-encaps(std::span<const uint8_t, keyBytes> m, // step 1
-       std::span<const uint8_t, saber_utils::kem_pklen<L, EP, seedBytes>()> pkey,
-       std::span<uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
-       std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+encaps_with(std::span<const uint8_t, sha3_256::DIGEST_LEN> hashed_m,
+            const PK& pkey,
+            std::span<const uint8_t, sha3_256::DIGEST_LEN> hashed_pk,
+            std::span<uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+            std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
   requires(saber_params::validate_kem_encaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
 {
-  std::array<uint8_t, sha3_256::DIGEST_LEN> hashed_m;
-  std::array<uint8_t, sha3_256::DIGEST_LEN> hashed_pk;
   std::array<uint8_t, sha3_512::DIGEST_LEN> rk;
   std::array<uint8_t, sha3_256::DIGEST_LEN> r_prm;
 
-  // step 2
-  sha3_256::sha3_256_t h256;
-  h256.absorb(m);
-  h256.finalize();
-  h256.digest(hashed_m);
-  h256.reset();
-
-  // step 3
-  h256.absorb(pkey);
-  h256.finalize();
-  h256.digest(hashed_pk);
-  h256.reset();
-
   // step 4, 5
   sha3_512::sha3_512_t h512;
   h512.absorb(hashed_m);
@@ -91,11 +103,11 @@ encaps(std::span<const uint8_t, keyBytes> m, // step 1
   auto r = std::span(rk).template subspan<keyBytes, keyBytes>();
 
   // step 7
-  auto _hm = std::span<const uint8_t, hashed_m.size()>(hashed_m);
   auto _r = std::span<const uint8_t, r.size()>(r);
-  saber_pke::encrypt<L, EQ, EP, ET, MU, seedBytes, uniform_sampling>(_hm, _r, pkey, ctxt);
+  saber_pke::encrypt<L, EQ, EP, ET, MU, seedBytes, uniform_sampling>(hashed_m, _r, pkey, ctxt);
 
   // step 8
+  sha3_256::sha3_256_t h256;
   h256.absorb(ctxt);
   h256.finalize();
   h256.digest(r_prm);
@@ -109,28 +121,101 @@ encaps(std::span<const uint8_t, keyBytes> m, // step 1
   h256.reset();
 }
 
-// Given Saber KEM cipher text and Saber KEM secret key, this routine can be used for
-// decapsulating the received cipher text, extracting a shared secret key of 32 -bytes.
-// This is an implementation of algorithm 22 in section 8.5.3 of Saber spec.
+// Given keyBytes input `m` ( random sampled ) and Saber KEM public key ( prepared, see
+// `prepared_pkey_t` ), this routine can be used for generating a session key ( of 32
+// -bytes ) and Saber KEM cipher text. This is an implementation of algorithm 21 in
+// section 8.5.2 of Saber spec, where step 3 is already done while preparing public key.
 template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling>
 inline void
-decaps(std::span<const uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
-       std::span<const uint8_t, saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>()> skey,
+encaps(std::span<const uint8_t, keyBytes> m,
+       const prepared_pkey_t<L, EQ, EP, seedBytes>& pkey,
+       std::span<uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
        std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
-  requires(saber_params::validate_kem_decaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
+  requires(saber_params::validate_kem_encaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
 {
-  constexpr size_t pke_pklen = saber_utils::pke_pklen<L, EP, seedBytes>();
-  constexpr size_t pke_sklen = saber_utils::pke_sklen<L, EQ>();
+  std::array<uint8_t, sha3_256::DIGEST_LEN> hashed_m;
 
-  // step 1
-  auto sk = skey.template subspan<0, pke_sklen>();
-  constexpr size_t off0 = pke_sklen;
-  auto pk = skey.template subspan<off0, pke_pklen>();
-  constexpr size_t off1 = off0 + pke_pklen;
-  auto hash_pk = skey.template subspan<off1, sha3_256::DIGEST_LEN>();
-  constexpr size_t off2 = off1 + sha3_256::DIGEST_LEN;
-  auto z = skey.template subspan<off2, keyBytes>();
+  // step 2
+  sha3_256::sha3_256_t h256;
+  h256.absorb(m);
+  h256.finalize();
+  h256.digest(hashed_m);
+  h256.reset();
+
+  encaps_with<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(hashed_m, pkey.pke, pkey.hashed_pk, ctxt, seskey);
+}
 
+// Given keyBytes input `m` ( random sampled ) and Saber KEM public key, this routine
+// can be used for generating a session key ( of 32 -bytes ) and Saber KEM cipher text.
+// This is an implementation of algorithm 21 in section 8.5.2 of Saber spec. Matrix A is
+// expanded on the fly, while being multiplied, see `saber_pke::pkey_stream_t`, while
+// independent digests of `m` and public key are computed together.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling>
+inline void
+encaps(std::span<const uint8_t, keyBytes> m,
+       std::span<const uint8_t, saber_utils::kem_pklen<L, EP, seedBytes>()> pkey,
+       std::span<uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+       std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+  requires(saber_params::validate_kem_encaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
+{
+  std::array<uint8_t, sha3_256::DIGEST_LEN> hashed_m;
+  std::array<uint8_t, sha3_256::DIGEST_LEN> hashed_pk;
+
+  // step 2, 3 - both digests are computed together, using 2-way Keccak, see
+  // `keccak_batch::sponge_t::hash`
+  keccak_batch::sha3_256_t<2>::hash({ m, pkey }, { hashed_m, hashed_pk });
+
+  const saber_pke::pkey_stream_t<L, EQ, EP, seedBytes> pkey_stream(pkey);
+  encaps_with<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(hashed_m, pkey_stream, hashed_pk, ctxt, seskey);
+}
+
+// Saber KEM secret key, prepared for repeated decapsulation under it i.e. secret vector
+// s ( unpacked from PKE secret key ), matrix A and vector b ( expanded and unpacked from
+// embedded PKE public key ), all in evaluation domain of polynomial multiplier, are
+// computed only once, while digest of public key and `z` are copied out of secret key.
+// Meant to be built once for a long-lived, static secret key, so that each decapsulation
+// is left with decryption and re-encryption, without any parsing or public key hashing.
+template<size_t L, size_t EQ, size_t EP, size_t seedBytes, size_t keyBytes>
+struct prepared_skey_t
+{
+  saber_pke::skey_eval_t<L, EQ> sk;
+  saber_pke::pkey_eval_t<L, EQ, EP, seedBytes> pk;
+  std::array<uint8_t, sha3_256::DIGEST_LEN> hash_pk;
+  std::array<uint8_t, keyBytes> z;
+
+  // Given a Saber KEM secret key, this routine slices it ( step 1 of algorithm 22 ) and
+  // unpacks, expands each of its components.
+  inline explicit prepared_skey_t(std::span<const uint8_t, saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>()> skey)
+    : sk(skey.template subspan<0, saber_utils::pke_sklen<L, EQ>()>())
+    , pk(skey.template subspan<saber_utils::pke_sklen<L, EQ>(), saber_utils::pke_pklen<L, EP, seedBytes>()>())
+  {
+    constexpr size_t off = saber_utils::pke_sklen<L, EQ>() + saber_utils::pke_pklen<L, EP, seedBytes>();
+
+    std::memcpy(hash_pk.data(), skey.data() + off, hash_pk.size());
+    std::memcpy(z.data(), skey.data() + off + hash_pk.size(), z.size());
+  }
+};
+
+// Given Saber KEM cipher text and components of Saber KEM secret key i.e. Saber PKE secret
+// key ( either in evaluation domain or serialized, see `saber_pke::decrypt` ), Saber PKE
+// public key ( see `saber_pke::encrypt` for accepted forms ), digest of public key and
+// `z`, this routine decapsulates the received cipher text, extracting a shared secret key
+// of 32 -bytes. This is an implementation of algorithm 22 in section 8.5.3 of Saber spec,
+// where step 1 is already done by caller.
+//
+// When secret key is serialized, it's evaluated inside decryption only, so that evaluated
+// secret vector s isn't kept on stack during re-encryption.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling, typename SK, typename PK>
+inline void
+decaps_with(std::span<const uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+            const SK& sk,
+            const PK& pk,
+            std::span<const uint8_t, sha3_256::DIGEST_LEN> hash_pk,
+            std::span<const uint8_t, keyBytes> z,
+            std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+  requires(saber_params::validate_kem_decaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling) &&
+           (std::same_as<SK, saber_pke::skey_eval_t<L, EQ>> || std::same_as<SK, std::span<const uint8_t, saber_utils::pke_sklen<L, EQ>()>>))
+{
   std::array<uint8_t, sha3_256::DIGEST_LEN> m;
   std::array<uint8_t, sha3_512::DIGEST_LEN> rk;
   std::array<uint8_t, ctxt.size()> ctxt_prm;
@@ -177,4 +262,274 @@ decaps(std::span<const uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
   h256.reset();
 }
 
+// Given Saber KEM cipher text and Saber KEM secret key ( prepared, see
+// `prepared_skey_t` ), this routine can be used for decapsulating the received cipher
+// text, extracting a shared secret key of 32 -bytes. This is an implementation of
+// algorithm 22 in section 8.5.3 of Saber spec, where step 1 is already done while
+// preparing secret key.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling>
+inline void
+decaps(std::span<const uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+       const prepared_skey_t<L, EQ, EP, seedBytes, keyBytes>& skey,
+       std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+  requires(saber_params::validate_kem_decaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
+{
+  decaps_with<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(ctxt, skey.sk, skey.pk, skey.hash_pk, skey.z, seskey);
+}
+
+// Given Saber KEM cipher text and Saber KEM secret key, this routine can be used for
+// decapsulating the received cipher text, extracting a shared secret key of 32 -bytes.
+// This is an implementation of algorithm 22 in section 8.5.3 of Saber spec. Matrix A
+// is expanded on the fly, during re-encryption, see `saber_pke::pkey_stream_t`, while
+// secret vector s is evaluated only for the duration of decryption.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling>
+inline void
+decaps(std::span<const uint8_t, saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+       std::span<const uint8_t, saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>()> skey,
+       std::span<uint8_t, sha3_256::DIGEST_LEN> seskey)
+  requires(saber_params::validate_kem_decaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
+{
+  constexpr size_t pke_pklen = saber_utils::pke_pklen<L, EP, seedBytes>();
+  constexpr size_t pke_sklen = saber_utils::pke_sklen<L, EQ>();
+
+  // step 1
+  auto sk = skey.template subspan<0, pke_sklen>();
+  constexpr size_t off0 = pke_sklen;
+  auto pk = skey.template subspan<off0, pke_pklen>();
+  constexpr size_t off1 = off0 + pke_pklen;
+  auto hash_pk = skey.template subspan<off1, sha3_256::DIGEST_LEN>();
+  constexpr size_t off2 = off1 + sha3_256::DIGEST_LEN;
+  auto z = skey.template subspan<off2, keyBytes>();
+
+  const saber_pke::pkey_stream_t<L, EQ, EP, seedBytes> pk_stream(pk);
+  decaps_with<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(ctxt, sk, pk_stream, hash_pk, z, seskey);
+}
+
+// Given n -many `seedA`, `seedS` and `z` ( each laid out contiguously ), this routine
+// generates n -many Saber KEM keypairs, i-th one from i-th seeds, writing them out
+// contiguously, same as calling `keygen` n times. Keypairs are generated in groups of
+// `keccak_batch::LANES`, each step being applied on whole group at once, so that all
+// SHAKE128/ SHA3 calls are served by multi-buffer Keccak. Remaining n mod LANES keypairs
+// are generated one by one.
+//
+// Ring products of a group stay in evaluation domain of small-secret multiplier ( see
+// `saber_pke::domain_t` ), one operation at a time, same as in single-operation routines,
+// instead of being pushed through batched Karatsuba ( see `polymul_batch` ), which doesn't
+// pay off for all parameter sets, even against general purpose multiplier, compare
+// `matvec/group/*` benchmarks. Same holds for `encaps_batch` and `decaps_batch`.
+template<size_t L, size_t EQ, size_t EP, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling, size_t n>
+inline void
+keygen_batch(std::span<const uint8_t, n * seedBytes> seedA,
+             std::span<const uint8_t, n * noiseBytes> seedS,
+             std::span<const uint8_t, n * keyBytes> z,
+             std::span<uint8_t, n * saber_utils::kem_pklen<L, EP, seedBytes>()> pkey,
+             std::span<uint8_t, n * saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>()> skey)
+  requires(saber_params::validate_kem_keygen_args(L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling))
+{
+  constexpr size_t lanes = keccak_batch::LANES;
+
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t pke_pklen = saber_utils::pke_pklen<L, EP, seedBytes>();
+  constexpr size_t pke_sklen = saber_utils::pke_sklen<L, EQ>();
+
+  constexpr size_t off0 = pke_sklen;
+  constexpr size_t off1 = off0 + pke_pklen;
+  constexpr size_t off2 = off1 + sha3_256::DIGEST_LEN;
+
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    const auto _pkey = pkey.subspan(i * pklen, lanes * pklen);
+    const auto _skey = skey.subspan(i * sklen, lanes * sklen);
+
+    // step 1
+    saber_pke::keygen_batch<L, EQ, EP, MU, seedBytes, noiseBytes, uniform_sampling, lanes>(
+      keccak_batch::split<lanes>(seedA.subspan(i * seedBytes), seedBytes, 0, seedBytes),
+      keccak_batch::split<lanes>(seedS.subspan(i * noiseBytes), noiseBytes, 0, noiseBytes),
+      keccak_batch::split<lanes>(_pkey, pklen, 0, pklen),
+      keccak_batch::split<lanes>(_skey, sklen, 0, pke_sklen));
+
+    // step 2, 4 ( partial )
+    const auto pks = keccak_batch::split<lanes>(std::span<const uint8_t>(_pkey), pklen, 0, pklen);
+    keccak_batch::sha3_256_t<lanes>::hash(pks, keccak_batch::split<lanes>(_skey, sklen, off1, sha3_256::DIGEST_LEN));
+
+    // step 4 ( partial )
+    for (size_t k = 0; k < lanes; k++) {
+      std::memcpy(_skey.data() + k * sklen + off0, pks[k].data(), pklen);
+      std::memcpy(_skey.data() + k * sklen + off2, z.data() + (i + k) * keyBytes, keyBytes);
+    }
+  }
+
+  for (; i < n; i++) {
+    keygen<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling>(seedA.subspan(i * seedBytes).template first<seedBytes>(),
+                                                                             seedS.subspan(i * noiseBytes).template first<noiseBytes>(),
+                                                                             z.subspan(i * keyBytes).template first<keyBytes>(),
+                                                                             pkey.subspan(i * pklen).template first<pklen>(),
+                                                                             skey.subspan(i * sklen).template first<sklen>());
+  }
+}
+
+// Given n -many keyBytes inputs `m` ( random sampled ) and n -many Saber KEM public keys
+// ( each laid out contiguously ), this routine encapsulates i-th `m` against i-th public
+// key, writing out n -many cipher texts and session keys contiguously, same as calling
+// `encaps` n times. Encapsulations are performed in groups of `keccak_batch::LANES`, each
+// step being applied on whole group at once, so that all SHAKE128/ SHA3 calls are served
+// by multi-buffer Keccak. Remaining n mod LANES encapsulations are performed one by one.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling, size_t n>
+inline void
+encaps_batch(std::span<const uint8_t, n * keyBytes> m,
+             std::span<const uint8_t, n * saber_utils::kem_pklen<L, EP, seedBytes>()> pkey,
+             std::span<uint8_t, n * saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+             std::span<uint8_t, n * sha3_256::DIGEST_LEN> seskey)
+  requires(saber_params::validate_kem_encaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
+{
+  constexpr size_t lanes = keccak_batch::LANES;
+
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+  constexpr size_t hlen = sha3_256::DIGEST_LEN;
+  constexpr size_t rklen = sha3_512::DIGEST_LEN;
+
+  std::array<uint8_t, lanes * hlen> hashed_m;
+  std::array<uint8_t, lanes * hlen> hashed_pk;
+  std::array<uint8_t, lanes * rklen> rk;
+  std::array<uint8_t, lanes * hlen> r_prm;
+
+  const auto _hashed_m = keccak_batch::split<lanes>(std::span<const uint8_t>(hashed_m), hlen, 0, hlen);
+  const auto _hashed_pk = keccak_batch::split<lanes>(std::span<const uint8_t>(hashed_pk), hlen, 0, hlen);
+  const auto k = keccak_batch::split<lanes>(std::span<const uint8_t>(rk), rklen, 0, keyBytes);
+  const auto r = keccak_batch::split<lanes>(std::span<const uint8_t>(rk), rklen, keyBytes, keyBytes);
+  const auto _r_prm = keccak_batch::split<lanes>(std::span<const uint8_t>(r_prm), hlen, 0, hlen);
+
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    const auto pks = keccak_batch::split<lanes>(pkey.subspan(i * pklen), pklen, 0, pklen);
+    const auto cts = keccak_batch::split<lanes>(ctxt.subspan(i * ctlen), ctlen, 0, ctlen);
+
+    // step 2, 3
+    keccak_batch::sha3_256_t<lanes>::hash(keccak_batch::split<lanes>(m.subspan(i * keyBytes), keyBytes, 0, keyBytes),
+                                          keccak_batch::split<lanes>(std::span(hashed_m), hlen, 0, hlen));
+    keccak_batch::sha3_256_t<lanes>::hash(pks, keccak_batch::split<lanes>(std::span(hashed_pk), hlen, 0, hlen));
+
+    // step 4, 5
+    keccak_batch::sha3_512_t<lanes> h512;
+    h512.absorb(_hashed_m);
+    h512.absorb(_hashed_pk);
+    h512.finalize();
+    h512.squeeze(keccak_batch::split<lanes>(std::span(rk), rklen, 0, rklen));
+
+    // step 6, 7
+    saber_pke::encrypt_batch<L, EQ, EP, ET, MU, seedBytes, uniform_sampling, lanes>(_hashed_m, r, pks, cts);
+
+    // step 8
+    keccak_batch::sha3_256_t<lanes>::hash(keccak_batch::split<lanes>(std::span<const uint8_t>(ctxt.subspan(i * ctlen)), ctlen, 0, ctlen),
+                                          keccak_batch::split<lanes>(std::span(r_prm), hlen, 0, hlen));
+
+    // step 9, 10
+    keccak_batch::sha3_256_t<lanes> h256;
+    h256.absorb(k);
+    h256.absorb(_r_prm);
+    h256.finalize();
+    h256.squeeze(keccak_batch::split<lanes>(seskey.subspan(i * hlen), hlen, 0, hlen));
+  }
+
+  for (; i < n; i++) {
+    encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(m.subspan(i * keyBytes).template first<keyBytes>(),
+                                                                     pkey.subspan(i * pklen).template first<pklen>(),
+                                                                     ctxt.subspan(i * ctlen).template first<ctlen>(),
+                                                                     seskey.subspan(i * hlen).template first<hlen>());
+  }
+}
+
+// Given n -many Saber KEM cipher texts and n -many Saber KEM secret keys ( each laid out
+// contiguously ), this routine decapsulates i-th cipher text under i-th secret key,
+// writing out n -many session keys contiguously, same as calling `decaps` n times.
+// Decapsulations are performed in groups of `keccak_batch::LANES`, each step being
+// applied on whole group at once, so that all SHAKE128/ SHA3 calls of re-encryption and
+// key derivation are served by multi-buffer Keccak. Remaining n mod LANES decapsulations
+// are performed one by one.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t keyBytes, bool uniform_sampling, size_t n>
+inline void
+decaps_batch(std::span<const uint8_t, n * saber_utils::kem_ctlen<L, EP, ET>()> ctxt,
+             std::span<const uint8_t, n * saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>()> skey,
+             std::span<uint8_t, n * sha3_256::DIGEST_LEN> seskey)
+  requires(saber_params::validate_kem_decaps_args(L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling))
+{
+  constexpr size_t lanes = keccak_batch::LANES;
+
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+  constexpr size_t pke_pklen = saber_utils::pke_pklen<L, EP, seedBytes>();
+  constexpr size_t pke_sklen = saber_utils::pke_sklen<L, EQ>();
+  constexpr size_t hlen = sha3_256::DIGEST_LEN;
+  constexpr size_t rklen = sha3_512::DIGEST_LEN;
+
+  constexpr size_t off0 = pke_sklen;
+  constexpr size_t off1 = off0 + pke_pklen;
+  constexpr size_t off2 = off1 + hlen;
+
+  std::array<uint8_t, lanes * hlen> m;
+  std::array<uint8_t, lanes * rklen> rk;
+  std::array<uint8_t, lanes * ctlen> ctxt_prm;
+  std::array<uint8_t, lanes * hlen> r_prm;
+  std::array<uint8_t, lanes * keyBytes> temp;
+
+  const auto _m = keccak_batch::split<lanes>(std::span<const uint8_t>(m), hlen, 0, hlen);
+  const auto r = keccak_batch::split<lanes>(std::span<const uint8_t>(rk), rklen, keyBytes, keyBytes);
+  const auto _r_prm = keccak_batch::split<lanes>(std::span<const uint8_t>(r_prm), hlen, 0, hlen);
+  const auto _temp = keccak_batch::split<lanes>(std::span<const uint8_t>(temp), keyBytes, 0, keyBytes);
+
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    const auto _ctxt = ctxt.subspan(i * ctlen, lanes * ctlen);
+    const auto _skey = skey.subspan(i * sklen, lanes * sklen);
+
+    // step 1, 2
+    for (size_t k = 0; k < lanes; k++) {
+      const auto ct = _ctxt.subspan(k * ctlen).template first<ctlen>();
+      const auto sk = _skey.subspan(k * sklen).template first<pke_sklen>();
+
+      const saber_pke::skey_eval_t<L, EQ> sk_hat(sk);
+      saber_pke::decrypt<L, EQ, EP, ET, MU, uniform_sampling>(ct, sk_hat, std::span(m).subspan(k * hlen).template first<hlen>());
+    }
+
+    // step 3, 4
+    keccak_batch::sha3_512_t<lanes> h512;
+    h512.absorb(_m);
+    h512.absorb(keccak_batch::split<lanes>(_skey, sklen, off1, hlen));
+    h512.finalize();
+    h512.squeeze(keccak_batch::split<lanes>(std::span(rk), rklen, 0, rklen));
+
+    // step 5, 6
+    saber_pke::encrypt_batch<L, EQ, EP, ET, MU, seedBytes, uniform_sampling, lanes>(
+      _m, r, keccak_batch::split<lanes>(_skey, sklen, off0, pke_pklen), keccak_batch::split<lanes>(std::span(ctxt_prm), ctlen, 0, ctlen));
+
+    // step 7, 9, 10, 11, 12
+    for (size_t k = 0; k < lanes; k++) {
+      const auto c = saber_utils::ct_eq_bytes<ctlen>(std::span<const uint8_t>(ctxt_prm).subspan(k * ctlen).template first<ctlen>(),
+                                                     _ctxt.subspan(k * ctlen).template first<ctlen>());
+      saber_utils::ct_sel_bytes<keyBytes>(c,
+                                          std::span(temp).subspan(k * keyBytes).template first<keyBytes>(),
+                                          std::span<const uint8_t>(rk).subspan(k * rklen).template first<keyBytes>(),
+                                          _skey.subspan(k * sklen + off2).template first<keyBytes>());
+    }
+
+    // step 8
+    keccak_batch::sha3_256_t<lanes>::hash(keccak_batch::split<lanes>(_ctxt, ctlen, 0, ctlen), keccak_batch::split<lanes>(std::span(r_prm), hlen, 0, hlen));
+
+    // step 13
+    keccak_batch::sha3_256_t<lanes> h256;
+    h256.absorb(_temp);
+    h256.absorb(_r_prm);
+    h256.finalize();
+    h256.squeeze(keccak_batch::split<lanes>(seskey.subspan(i * hlen), hlen, 0, hlen));
+  }
+
+  for (; i < n; i++) {
+    decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(ctxt.subspan(i * ctlen).template first<ctlen>(),
+                                                                     skey.subspan(i * sklen).template first<sklen>(),
+                                                                     seskey.subspan(i * hlen).template first<hlen>());
+  }
+}
+
 }
@@ -0,0 +1,121 @@
+#pragma once
+#include "karatsuba.hpp"
+#include "params.hpp"
+#include "zq.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+// Kronecker Substitution based Multiplication of two Polynomials, using 64 -bit integer
+// multiplications
+namespace kronecker {
+
+// Input coefficients are reduced modulo 2^13 before being packed, so that each
+// coefficient of product of two polynomials of degree < 64 stays below 64 * 2^26 = 2^32
+// and fits in its own 32 -bit slot. Hence multiplication result is correct only when
+// reduced by some power of 2 moduli <= 2^13.
+constexpr uint16_t MAX_MODULI = 1u << 13;
+constexpr uint16_t COEFF_MASK = MAX_MODULI - 1;
+constexpr size_t SLOT_BITS = 32;
+
+// Polynomials of degree < `CUTOFF` are multiplied by Kronecker substitution, while
+// Karatsuba recursion is used above it.
+constexpr size_t CUTOFF = 32;
+
+__extension__ typedef unsigned __int128 uint128_t;
+
+// Given two polynomials of degree N-1 ( s.t. N is even and N <= 64 ), this routine
+// evaluates both of them at x = 2^32, packing two coefficients in each 64 -bit limb,
+// multiplies resulting integers using product-scanning schoolbook algorithm over 64 -bit
+// limbs and adds coefficients of product polynomial of degree 2*N - 1, which can be read
+// off consecutive 32 -bit slots, to `polyab`.
+template<size_t N>
+static inline constexpr void
+mul_acc(std::span<const zq::zq_t, N> polya, std::span<const zq::zq_t, N> polyb, std::span<zq::zq_t, 2 * N> polyab)
+  requires(((N & 1) == 0) && (N <= 64))
+{
+  constexpr size_t LIMBS = N / 2;
+
+  std::array<uint64_t, LIMBS> x;
+  std::array<uint64_t, LIMBS> y;
+
+  for (size_t i = 0; i < LIMBS; i++) {
+    x[i] = static_cast<uint64_t>(polya[2 * i].as_raw() & COEFF_MASK) |
+           (static_cast<uint64_t>(polya[2 * i + 1].as_raw() & COEFF_MASK) << SLOT_BITS);
+    y[i] = static_cast<uint64_t>(polyb[2 * i].as_raw() & COEFF_MASK) |
+           (static_cast<uint64_t>(polyb[2 * i + 1].as_raw() & COEFF_MASK) << SLOT_BITS);
+  }
+
+  // Each limb product is < 2^92 ( three partial products of 2^26, at 32 -bit offsets ),
+  // so that all of them, contributing to same column, can be summed up without any carry
+  // propagation, which is done only once per column.
+  std::array<uint64_t, 2 * LIMBS> z;
+  uint128_t carry = 0;
+
+  for (size_t k = 0; k < 2 * LIMBS - 1; k++) {
+    const size_t beg = (k + 1 > LIMBS) ? (k + 1 - LIMBS) : 0;
+    const size_t end = std::min(k + 1, LIMBS);
+
+    // Two independent accumulators, breaking dependency chain of 128 -bit additions
+    uint128_t acc0 = carry;
+    uint128_t acc1 = 0;
+
+    size_t i = beg;
+    for (; i + 1 < end; i += 2) {
+      acc0 += static_cast<uint128_t>(x[i]) * y[k - i];
+      acc1 += static_cast<uint128_t>(x[i + 1]) * y[k - i - 1];
+    }
+    if (i < end) {
+      acc0 += static_cast<uint128_t>(x[i]) * y[k - i];
+    }
+
+    const uint128_t acc = acc0 + acc1;
+
+    z[k] = static_cast<uint64_t>(acc);
+    carry = acc >> 64;
+  }
+
+  z[2 * LIMBS - 1] = static_cast<uint64_t>(carry);
+
+  for (size_t i = 0; i < 2 * LIMBS; i++) {
+    polyab[2 * i] += zq::zq_t(static_cast<uint16_t>(z[i]));
+    polyab[2 * i + 1] += zq::zq_t(static_cast<uint16_t>(z[i] >> SLOT_BITS));
+  }
+}
+
+// Multiplies polynomials at leaves of Karatsuba recursion, using Kronecker substitution.
+struct leaf_t
+{
+  template<size_t N>
+  static inline constexpr void mul(std::span<const zq::zq_t, N> polya, std::span<const zq::zq_t, N> polyb, std::span<zq::zq_t, 2 * N> polyab)
+  {
+    std::fill(polyab.begin(), polyab.end(), zq::zq_t());
+    mul_acc<N>(polya, polyb, polyab);
+  }
+};
+
+// Given two polynomials of degree N-1 ( s.t. N is power of 2 and N >= 2 ), this routine
+// multiplies them using Karatsuba algorithm, with Kronecker substitution at leaves, and
+// reduces result modulo (x ** N + 1).
+//
+// Note, only lowest 13 -bits of each resulting coefficient are correct, see `MAX_MODULI`.
+template<size_t N>
+static inline constexpr std::array<zq::zq_t, N>
+kronmul(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& polyb)
+  requires(saber_params::is_power_of_2(N) && (N >= 2))
+{
+  zq::uninit_t<std::array<zq::zq_t, 2 * N>> polyab;
+  zq::uninit_t<std::array<zq::zq_t, karatsuba::scratch_len<N, CUTOFF>()>> scratch;
+
+  karatsuba::karatsuba<N, CUTOFF, leaf_t>(polya, polyb, polyab.v, scratch.v);
+
+  std::array<zq::zq_t, N> res;
+  for (size_t i = 0; i < N; i++) {
+    res[i] = polyab.v[i] - polyab.v[N + i];
+  }
+
+  return res;
+}
+
+}
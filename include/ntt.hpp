@@ -0,0 +1,300 @@
+#pragma once
+#include "params.hpp"
+#include "zq.hpp"
+#include <array>
+#include <cstdint>
+
+// Number Theoretic Transform based Multiplication of two Polynomials, over NTT-friendly
+// primes, s.t. results can be lifted back to Zq, q = 2^16
+namespace ntt {
+
+// Saber's moduli ( i.e. powers of 2 ) don't support NTT. Though, given that integer
+// coefficients of two degree-255 polynomials are centered in [-2^15, 2^15), their
+// negacyclic product has coefficients bounded by 2^8 * 2^15 * 2^15 = 2^38 in absolute
+// value. Hence product can be computed exactly modulo two NTT-friendly primes s.t. P0 *
+// P1 > 2^59, then be reconstructed by CRT ( as centered integer, which is exact as long
+// as its absolute value is < P0 * P1 / 2, i.e. > 2^58 ) and reduced modulo 2^16. A sum of
+// up to 2^20 such products is bounded by 2^20 * 2^38 = 2^58, so it can also be
+// reconstructed exactly, which is sufficient for matrix vector multiplication,
+// accumulated in NTT domain.
+constexpr size_t N = 256;
+constexpr size_t LOG2N = saber_params::log2(N);
+
+constexpr uint32_t P0 = 2013265921; // = 15 * 2^27 + 1, with primitive root 31
+constexpr uint32_t P1 = 469762049;  // = 7 * 2^26 + 1, with primitive root 3
+
+// Compile-time compute (a * b) % P.
+template<uint32_t P>
+static inline constexpr uint32_t
+mul(const uint32_t a, const uint32_t b)
+{
+  return static_cast<uint32_t>((static_cast<uint64_t>(a) * static_cast<uint64_t>(b)) % P);
+}
+
+// Compile-time compute -P^-1 mod 2^32, using Newton's iteration, required for
+// Montgomery multiplication.
+template<uint32_t P>
+static inline constexpr uint32_t
+neg_inv()
+  requires((P & 1) == 1)
+{
+  uint32_t x = P; // correct modulo 2^3
+  for (size_t i = 0; i < 4; i++) {
+    x *= 2u - P * x;
+  }
+
+  return 0u - x;
+}
+
+// Given a, b ∈ [0, P) s.t. P < 2^31, this routine computes (a * b * R^-1) % P, R = 2^32,
+// using Montgomery multiplication, in constant-time.
+template<uint32_t P>
+static inline constexpr uint32_t
+mont_mul(const uint32_t a, const uint32_t b)
+{
+  constexpr uint32_t P_NEG_INV = neg_inv<P>();
+
+  const uint64_t t = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+  const uint32_t m = static_cast<uint32_t>(t) * P_NEG_INV;
+  const uint32_t u = static_cast<uint32_t>((t + static_cast<uint64_t>(m) * static_cast<uint64_t>(P)) >> 32);
+
+  const uint32_t v = u - P;
+  return v + (P & (0u - (v >> 31)));
+}
+
+// Compile-time compute (a + b) % P, in constant-time, given a, b ∈ [0, P) and P < 2^31.
+template<uint32_t P>
+static inline constexpr uint32_t
+add(const uint32_t a, const uint32_t b)
+{
+  const uint32_t t = a + b - P;
+  return t + (P & (0u - (t >> 31)));
+}
+
+// Compile-time compute (a - b) % P, in constant-time, given a, b ∈ [0, P) and P < 2^31.
+template<uint32_t P>
+static inline constexpr uint32_t
+sub(const uint32_t a, const uint32_t b)
+{
+  const uint32_t t = a - b;
+  return t + (P & (0u - (t >> 31)));
+}
+
+// Compile-time compute a ^ b % P, using square-and-multiply.
+template<uint32_t P>
+static inline constexpr uint32_t
+pow(const uint32_t a, const size_t b)
+{
+  uint32_t base = a;
+  uint32_t res = 1;
+
+  for (size_t i = b; i > 0; i >>= 1) {
+    if (i & 1) {
+      res = mul<P>(res, base);
+    }
+    base = mul<P>(base, base);
+  }
+
+  return res;
+}
+
+// Compile-time compute multiplicative inverse of a ∈ [1, P), using Fermat's little
+// theorem.
+template<uint32_t P>
+static inline constexpr uint32_t
+inv(const uint32_t a)
+{
+  return pow<P>(a, P - 2);
+}
+
+// Montgomery radix R = 2^32, modulo prime P.
+template<uint32_t P>
+constexpr uint32_t R_MOD = static_cast<uint32_t>((1ul << 32) % P);
+
+// Given a 64 -bit unsigned integer, this routine returns bit reversed value of its
+// lowest `mbw` -bits.
+template<size_t mbw>
+static inline constexpr size_t
+bit_rev(const size_t v)
+{
+  size_t v_rev = 0ul;
+
+  for (size_t i = 0; i < mbw; i++) {
+    const size_t bit = (v >> i) & 0b1;
+    v_rev ^= bit << (mbw - 1ul - i);
+  }
+
+  return v_rev;
+}
+
+// Compile-time compute powers of 2N -th primitive root of unity ψ, in bit-reversed
+// order, s.t. ψ = g ^ ((P - 1) / 2N). Each of them is kept in Montgomery form i.e.
+// multiplied by R = 2^32.
+template<uint32_t P, uint32_t g>
+static inline constexpr std::array<uint32_t, N>
+compute_zetas()
+  requires(((P - 1) % (2 * N)) == 0)
+{
+  constexpr uint32_t ψ = pow<P>(g, (P - 1) / (2 * N));
+  static_assert(pow<P>(ψ, N) == P - 1, "ψ must be 2N -th primitive root of unity !");
+
+  std::array<uint32_t, N> res{};
+  for (size_t i = 0; i < N; i++) {
+    res[i] = mul<P>(pow<P>(ψ, bit_rev<LOG2N>(i)), R_MOD<P>);
+  }
+
+  return res;
+}
+
+// Powers of ψ, modulo each prime, in bit-reversed order and Montgomery form.
+constexpr auto ZETAS0 = compute_zetas<P0, 31>();
+constexpr auto ZETAS1 = compute_zetas<P1, 3>();
+
+// Scaling factor applied at the end of inverse NTT, modulo each prime. Given that
+// Montgomery multiplication of two polynomials in NTT domain leaves a factor of R^-1,
+// it's compensated here, along with N^-1 i.e. scaling factor = N^-1 * R^2, so that
+// Montgomery multiplication by it results into multiplication by N^-1 * R.
+constexpr uint32_t INV_N0 = mul<P0>(inv<P0>(N), mul<P0>(R_MOD<P0>, R_MOD<P0>));
+constexpr uint32_t INV_N1 = mul<P1>(inv<P1>(N), mul<P1>(R_MOD<P1>, R_MOD<P1>));
+
+// Multiplicative inverse of P0, modulo P1, required for CRT reconstruction.
+constexpr uint32_t INV_P0_MOD_P1 = inv<P1>(P0 % P1);
+constexpr uint64_t P0P1 = static_cast<uint64_t>(P0) * static_cast<uint64_t>(P1);
+
+// Given a polynomial ( in coefficient form ) over Z_P, this routine applies in-place
+// forward NTT, using Cooley-Tukey butterfly, s.t. negacyclic convolution of two
+// polynomials boils down to point-wise multiplication of their NTT representations.
+template<uint32_t P, const std::array<uint32_t, N>& zetas>
+static inline constexpr void
+forward(std::array<uint32_t, N>& poly)
+{
+  size_t k = 0;
+
+  for (size_t len = N / 2; len >= 1; len >>= 1) {
+    for (size_t start = 0; start < N; start += 2 * len) {
+      const uint32_t zeta = zetas[++k];
+
+      for (size_t i = start; i < start + len; i++) {
+        const uint32_t t = mont_mul<P>(zeta, poly[i + len]);
+
+        poly[i + len] = sub<P>(poly[i], t);
+        poly[i] = add<P>(poly[i], t);
+      }
+    }
+  }
+}
+
+// Given a polynomial ( in NTT representation ) over Z_P, this routine applies in-place
+// inverse NTT, using Gentleman-Sande butterfly, bringing it back to coefficient form.
+template<uint32_t P, const std::array<uint32_t, N>& zetas, uint32_t inv_n>
+static inline constexpr void
+inverse(std::array<uint32_t, N>& poly)
+{
+  size_t k = N;
+
+  for (size_t len = 1; len < N; len <<= 1) {
+    for (size_t start = 0; start < N; start += 2 * len) {
+      const uint32_t zeta = P - zetas[--k];
+
+      for (size_t i = start; i < start + len; i++) {
+        const uint32_t t = poly[i];
+
+        poly[i] = add<P>(t, poly[i + len]);
+        poly[i + len] = mont_mul<P>(zeta, sub<P>(t, poly[i + len]));
+      }
+    }
+  }
+
+  for (size_t i = 0; i < N; i++) {
+    poly[i] = mont_mul<P>(poly[i], inv_n);
+  }
+}
+
+// Degree-255 polynomial in NTT domain, represented by its residues modulo P0 and P1.
+struct ntt_poly_t
+{
+  std::array<uint32_t, N> r0{};
+  std::array<uint32_t, N> r1{};
+
+  // Point-wise multiplication of two polynomials in NTT domain. Note, resulting
+  // polynomial carries a factor of R^-1, which is compensated during inverse NTT, so
+  // product of two polynomials must not be multiplied again, before being brought back
+  // to coefficient form.
+  inline constexpr ntt_poly_t operator*(const ntt_poly_t& rhs) const
+  {
+    ntt_poly_t res;
+
+    for (size_t i = 0; i < N; i++) {
+      res.r0[i] = mont_mul<P0>(r0[i], rhs.r0[i]);
+      res.r1[i] = mont_mul<P1>(r1[i], rhs.r1[i]);
+    }
+
+    return res;
+  }
+
+  // Point-wise addition of two polynomials in NTT domain.
+  inline constexpr void operator+=(const ntt_poly_t& rhs)
+  {
+    for (size_t i = 0; i < N; i++) {
+      r0[i] = add<P0>(r0[i], rhs.r0[i]);
+      r1[i] = add<P1>(r1[i], rhs.r1[i]);
+    }
+  }
+};
+
+// Given a polynomial over Zq ( q = 2^16 ), this routine lifts each of its coefficients
+// to centered representative ∈ [-2^15, 2^15) and computes its NTT representation modulo
+// both primes.
+static inline constexpr ntt_poly_t
+to_ntt(const std::array<zq::zq_t, N>& poly)
+{
+  ntt_poly_t res;
+
+  for (size_t i = 0; i < N; i++) {
+    const auto v = static_cast<int32_t>(static_cast<int16_t>(poly[i].as_raw()));
+    const auto mask = static_cast<uint32_t>(v >> 31);
+
+    res.r0[i] = static_cast<uint32_t>(v) + (P0 & mask);
+    res.r1[i] = static_cast<uint32_t>(v) + (P1 & mask);
+  }
+
+  forward<P0, ZETAS0>(res.r0);
+  forward<P1, ZETAS1>(res.r1);
+
+  return res;
+}
+
+// Given a polynomial in NTT domain, this routine computes its coefficient form modulo
+// both primes, reconstructs exact ( centered ) integer coefficients using CRT and
+// reduces them modulo 2^16, producing polynomial over Zq.
+static inline constexpr std::array<zq::zq_t, N>
+from_ntt(const ntt_poly_t& poly)
+{
+  auto r0 = poly.r0;
+  auto r1 = poly.r1;
+
+  inverse<P0, ZETAS0, INV_N0>(r0);
+  inverse<P1, ZETAS1, INV_N1>(r1);
+
+  std::array<zq::zq_t, N> res;
+
+  for (size_t i = 0; i < N; i++) {
+    const uint32_t t = mul<P1>(sub<P1>(r1[i], r0[i] % P1), INV_P0_MOD_P1);
+    const uint64_t x = static_cast<uint64_t>(r0[i]) + static_cast<uint64_t>(P0) * static_cast<uint64_t>(t);
+    const uint64_t mask = 0ul - static_cast<uint64_t>(x > (P0P1 >> 1));
+
+    res[i] = static_cast<uint16_t>(x - (P0P1 & mask));
+  }
+
+  return res;
+}
+
+// Given two polynomials of degree N-1, this routine multiplies them in NTT domain and
+// brings result back to coefficient form, computing their product modulo (x ** N + 1).
+static inline constexpr std::array<zq::zq_t, N>
+polymul(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& polyb)
+{
+  return from_ntt(to_ntt(polya) * to_ntt(polyb));
+}
+
+}
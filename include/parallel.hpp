@@ -0,0 +1,215 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+// Number of persistent worker threads, spawned ( only when `SABER_PARALLEL` is defined )
+// for spreading independent pieces of a single KEM operation, on top of calling thread.
+// Can be overridden in compile-time.
+#if !defined SABER_WORKERS
+#define SABER_WORKERS 3
+#endif
+
+// Intra-operation parallelism, spreading independent rows of matrix-vector products ( and
+// inner product, in encryption ) of a single KEM operation over a small pool of persistent
+// worker threads, cutting latency of that operation, at the cost of keeping more cores
+// busy. It's opt-in, enabled by defining `SABER_PARALLEL`, otherwise each loop, written in
+// terms of `for_each`, runs sequentially on calling thread.
+namespace parallel {
+
+// Fixed-size pool of worker threads, which are spawned once and kept alive, waiting on
+// an atomic epoch counter ( i.e. futex, no lock is taken for signalling ), which is bumped
+// whenever work is posted. A job is a range of task indices, whose tasks are claimed one
+// at a time, by workers and by the thread which posted the job, which also helps running
+// them, so that a job always completes, even when all workers are busy. Jobs can be
+// nested i.e. a task can post a job of its own, which is served by idle workers.
+template<size_t workers>
+struct pool_t
+{
+private:
+  // A range of `count` -many tasks, living on stack of the thread which posted it, till
+  // all of them are done.
+  struct job_t
+  {
+    void (*fn)(const void*, size_t);
+    const void* ctx;
+    size_t count;
+    size_t next = 0;
+    std::atomic<size_t> done = 0;
+    job_t* below = nullptr;
+  };
+
+  // Number of times an idle worker polls for work, before falling asleep.
+  static constexpr size_t SPINS = 1u << 12;
+
+  std::array<std::thread, workers> threads;
+  std::mutex lock;
+  job_t* top = nullptr;
+  std::atomic<uint32_t> epoch = 0;
+  bool stop = false;
+
+  // Claims next task of top-most job, which has any left, returning the job and task
+  // index. Once its last task is claimed, job is unlinked, so that nobody else touches
+  // it, except for marking claimed tasks as done.
+  inline job_t* claim(job_t* const only, size_t& idx)
+  {
+    std::lock_guard<std::mutex> guard(lock);
+
+    job_t** link = &top;
+    while ((*link != nullptr) && (only != nullptr) && (*link != only)) {
+      link = &(*link)->below;
+    }
+
+    job_t* const job = *link;
+    if (job == nullptr) {
+      return nullptr;
+    }
+
+    idx = job->next++;
+    if (job->next == job->count) {
+      *link = job->below;
+    }
+    return job;
+  }
+
+  // Runs claimed task and marks it done, which is last access of the job.
+  static inline void execute(job_t* const job, const size_t idx)
+  {
+    job->fn(job->ctx, idx);
+    job->done.fetch_add(1, std::memory_order_release);
+  }
+
+  inline void work()
+  {
+    uint32_t seen = epoch.load(std::memory_order_acquire);
+
+    while (true) {
+      size_t idx;
+      if (job_t* const job = claim(nullptr, idx)) {
+        execute(job, idx);
+        continue;
+      }
+
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        if (stop) {
+          return;
+        }
+      }
+
+      size_t spins = 0;
+      uint32_t now = epoch.load(std::memory_order_acquire);
+      while ((now == seen) && (spins < SPINS)) {
+        spins++;
+        now = epoch.load(std::memory_order_acquire);
+      }
+      if (now == seen) {
+        epoch.wait(seen, std::memory_order_acquire);
+        now = epoch.load(std::memory_order_acquire);
+      }
+      seen = now;
+    }
+  }
+
+  inline void wake()
+  {
+    epoch.fetch_add(1, std::memory_order_release);
+    epoch.notify_all();
+  }
+
+public:
+  inline pool_t()
+  {
+    for (size_t i = 0; i < workers; i++) {
+      threads[i] = std::thread([this]() { work(); });
+    }
+  }
+
+  inline ~pool_t()
+  {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      stop = true;
+    }
+    wake();
+
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+
+  pool_t(const pool_t&) = delete;
+  pool_t& operator=(const pool_t&) = delete;
+
+  // Given number of tasks and a callable, this routine invokes fn(i) for each i ∈ [0,
+  // count), spread over worker threads and calling thread, returning only after all of
+  // them are done. Tasks must be independent of each other.
+  template<typename F>
+  inline void run(const size_t count, const F& fn)
+  {
+    if (count == 0) {
+      return;
+    }
+    if ((workers == 0) || (count == 1)) {
+      for (size_t i = 0; i < count; i++) {
+        fn(i);
+      }
+      return;
+    }
+
+    job_t job{ .fn = [](const void* ctx, const size_t idx) { (*static_cast<const F*>(ctx))(idx); }, .ctx = &fn, .count = count };
+
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      job.below = top;
+      top = &job;
+    }
+    wake();
+
+    size_t idx;
+    while (claim(&job, idx) != nullptr) {
+      execute(&job, idx);
+    }
+
+    // Remaining tasks are being run by workers, which are waited on by spinning, given
+    // that each of them is short ( say a row of a matrix-vector product ).
+    while (job.done.load(std::memory_order_acquire) < count) {
+      std::this_thread::yield();
+    }
+  }
+};
+
+#if defined SABER_PARALLEL
+
+// Process-wide pool, spawned on first use. Function has external linkage ( i.e. not
+// `static` ), so that all translation units share one instance of it.
+inline pool_t<SABER_WORKERS>&
+pool()
+{
+  static pool_t<SABER_WORKERS> instance;
+  return instance;
+}
+
+#endif
+
+// Given number of tasks and a callable, this routine invokes fn(i) for each i ∈ [0,
+// count), either spread over process-wide worker pool ( when `SABER_PARALLEL` is defined )
+// or sequentially, on calling thread. Tasks must be independent of each other.
+template<typename F>
+static inline void
+for_each(const size_t count, const F& fn)
+{
+#if defined SABER_PARALLEL
+  pool().run(count, fn);
+#else
+  for (size_t i = 0; i < count; i++) {
+    fn(i);
+  }
+#endif
+}
+
+}
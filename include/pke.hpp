@@ -1,13 +1,21 @@
 #pragma once
 #include "consts.hpp"
+#include "keccak_batch.hpp"
+#include "parallel.hpp"
 #include "params.hpp"
+#include "poly_compact.hpp"
 #include "poly_matrix.hpp"
 #include "polynomial.hpp"
-#include "shake128.hpp"
+#include "smallmul.hpp"
 
 // Algorithms related to Saber Public Key Encryption
 namespace saber_pke {
 
+// Each ring product computed by Saber PKE has a secret operand ( i.e. vector s or s' ), so
+// all of them are computed in evaluation domain of small-secret multiplier, see
+// `smallmul`.
+using domain_t = smallmul::domain_t;
+
 // Given seedBytes -bytes `seedA` ( used for generating matrix A ) and noiseBytes
 // -bytes `seedS` ( used for generating secret vector s ), this routine can be used for
 // generating a Saber PKE public, private keypair, following algorithm 17 in
@@ -22,25 +30,37 @@ keygen(std::span<const uint8_t, seedBytes> seedA,  // step 1
 {
   constexpr uint16_t Q = 1u << EQ;
   constexpr uint16_t P = 1u << EP;
-  constexpr auto h = saber_consts::compute_polyvec_h<L, Q, EQ, EP>();
+  constexpr uint16_t h1 = saber_consts::compute_h1<EQ, EP>();
 
-  std::array<uint8_t, seedBytes> hashedSeedA{};
+  constexpr size_t poly_blen = (poly::N * MU) / 8;
 
-  // step 2
-  shake128::shake128_t hasher;
-  hasher.absorb(seedA);
+  std::array<uint8_t, seedBytes> hashedSeedA;
+  mat::poly_matrix_t<L, 1, Q> s;
+
+  // step 2, 5 - hashedSeedA and secret vector s are squeezed out of independent SHAKE128
+  // instances ( absorbing seedA and seedS, which are of same length ), which are driven
+  // together, using 2-way Keccak. Both instances are squeezed in lockstep, one polynomial
+  // of s at a time, while first seedBytes of the other one make hashedSeedA.
+  std::array<uint8_t, poly_blen> bufA;
+  std::array<uint8_t, poly_blen> bufS;
+
+  keccak_batch::shake128_t<2> hasher;
+  hasher.absorb({ seedA, seedS });
   hasher.finalize();
-  hasher.squeeze(hashedSeedA);
-  hasher.reset();
 
-  // step 4, 5
-  auto A = mat::poly_matrix_t<L, L, Q>::template gen_matrix<seedBytes>(hashedSeedA);
-  auto s = mat::poly_matrix_t<L, 1, Q>::template gen_secret<uniform_sampling, noiseBytes, MU>(seedS);
+  for (size_t i = 0; i < L; i++) {
+    hasher.squeeze({ bufA, bufS });
+    s[i] = saber_utils::sample_secret<Q, MU, uniform_sampling>(bufS);
+
+    if (i == 0) {
+      std::memcpy(hashedSeedA.data(), bufA.data(), seedBytes);
+    }
+  }
+  hasher.reset();
 
-  // step 6, 7, 8
-  auto A_T = A.transpose();
-  auto b = A_T.template mat_vec_mul<L>(s) + h;
-  auto b_p = (b >> (EQ - EP)).template mod<P>();
+  // step 4, 6 - matrix A is expanded while being multiplied, as transposed, so that it's
+  // neither materialized, nor copied into transposed layout
+  auto b = mat::poly_matrix_t<L, L, Q>::template gen_matrix_vec_mul<seedBytes, true>(hashedSeedA, s.template evaluate<domain_t>());
 
   // step 9
   s.to_bytes(skey);
@@ -49,10 +69,196 @@ keygen(std::span<const uint8_t, seedBytes> seedA,  // step 1
   auto pkey_pk = pkey.template subspan<0, pkey.size() - seedBytes>();
   auto pkey_seedA = pkey.template subspan<pkey_pk.size(), seedBytes>();
 
-  b_p.to_bytes(pkey_pk);
+  // step 7, 8, fused with serialization
+  b.template round_to_bytes<P, EQ - EP>(h1, pkey_pk);
   std::memcpy(pkey_seedA.data(), hashedSeedA.data(), seedBytes);
 }
 
+// Batched variant of `keygen`, generating `lanes` -many Saber PKE keypairs, i-th one from
+// i-th `seedA` and `seedS`. Each step is applied on all keypairs at once, so that
+// hashedSeedA, secret vectors and matrices are expanded by multi-buffer SHAKE128, while
+// matrix A of each keypair is multiplied ( as transposed ) while being expanded, see
+// `poly_matrix_t::gen_matrix_vec_mul_batch`.
+template<size_t L, size_t EQ, size_t EP, size_t MU, size_t seedBytes, size_t noiseBytes, bool uniform_sampling, size_t lanes>
+inline void
+keygen_batch(std::array<std::span<const uint8_t>, lanes> seedA,
+             std::array<std::span<const uint8_t>, lanes> seedS,
+             std::array<std::span<uint8_t>, lanes> pkey,
+             std::array<std::span<uint8_t>, lanes> skey)
+  requires(saber_params::validate_pke_keygen_args(L, EQ, EP, MU, seedBytes, noiseBytes, uniform_sampling))
+{
+  constexpr uint16_t Q = 1u << EQ;
+  constexpr uint16_t P = 1u << EP;
+  constexpr uint16_t h1 = saber_consts::compute_h1<EQ, EP>();
+
+  constexpr size_t pklen = saber_utils::pke_pklen<L, EP, seedBytes>();
+
+  std::array<uint8_t, lanes * seedBytes> hashedSeedA;
+
+  // step 2
+  keccak_batch::shake128_t<lanes> hasher;
+  hasher.absorb(seedA);
+  hasher.finalize();
+  hasher.squeeze(keccak_batch::split<lanes>(std::span(hashedSeedA), seedBytes, 0, seedBytes));
+  hasher.reset();
+
+  // step 5
+  const auto s = mat::poly_matrix_t<L, 1, Q>::template gen_secret_batch<uniform_sampling, MU, lanes>(seedS);
+
+  std::array<mat::poly_matrix_eval_t<L, 1, domain_t>, lanes> s_hat;
+  for (size_t k = 0; k < lanes; k++) {
+    s_hat[k] = s[k].template evaluate<domain_t>();
+  }
+
+  // step 4, 6
+  const auto seeds = keccak_batch::split<lanes>(std::span<const uint8_t>(hashedSeedA), seedBytes, 0, seedBytes);
+  const auto b = mat::poly_matrix_t<L, L, Q>::template gen_matrix_vec_mul_batch<true, lanes>(seeds, s_hat);
+
+  for (size_t k = 0; k < lanes; k++) {
+    // step 9
+    s[k].to_bytes(skey[k]);
+
+    // step 7, 8, 10, 11
+    b[k].template round_to_bytes<P, EQ - EP>(h1, pkey[k].first(pklen - seedBytes));
+    std::memcpy(pkey[k].data() + pklen - seedBytes, seeds[k].data(), seedBytes);
+  }
+}
+
+// Saber PKE public key, in evaluation domain of polynomial multiplier i.e. matrix A (
+// expanded from seedA ) and vector b ( unpacked from public key ) are transformed only
+// once and kept in memory, so that each encryption only needs to evaluate the fresh
+// secret vector s'. Meant to be built once for a long-lived public key, trading some
+// memory for cheaper encryption.
+template<size_t L, size_t EQ, size_t EP, size_t seedBytes>
+struct pkey_eval_t
+{
+  mat::poly_matrix_eval_t<L, L, domain_t> A;
+  mat::poly_matrix_eval_t<L, 1, domain_t> b;
+
+  // Given a Saber PKE public key, this routine expands matrix A from its seed, unpacks
+  // vector b and transforms both of them into evaluation domain.
+  inline explicit pkey_eval_t(std::span<const uint8_t, saber_utils::pke_pklen<L, EP, seedBytes>()> pkey)
+    : A(mat::poly_matrix_t<L, L, (1u << EQ)>::template gen_matrix<seedBytes>(pkey.template last<seedBytes>()))
+    , b(mat::poly_matrix_t<L, 1, (1u << EP)>(pkey.template first<pkey.size() - seedBytes>()))
+  {
+  }
+
+  // Given secret vector s' ( in evaluation domain ), computes A * s'.
+  template<uint16_t moduli>
+  inline mat::poly_matrix_t<L, 1, moduli> mat_vec_mul(const mat::poly_matrix_eval_t<L, 1, domain_t>& s_prm) const
+  {
+    return A.template mat_vec_mul<moduli>(s_prm);
+  }
+
+  // Given secret vector s' ( in evaluation domain ), computes b^T * s'.
+  template<uint16_t moduli>
+  inline poly::poly_t<moduli> inner_prod(const mat::poly_matrix_eval_t<L, 1, domain_t>& s_prm) const
+  {
+    return b.template inner_prod<moduli>(s_prm);
+  }
+};
+
+// Saber PKE public key, used as it is, in its serialized form, for encrypting only once
+// under it. Matrix A is expanded from seedA, one polynomial at a time, while being
+// multiplied ( see `poly_matrix_t::gen_matrix_vec_mul` ), so that it's never materialized,
+// neither in normal nor in evaluation domain. Exposes same interface as `pkey_eval_t`.
+template<size_t L, size_t EQ, size_t EP, size_t seedBytes>
+struct pkey_stream_t
+{
+  std::span<const uint8_t, saber_utils::pke_pklen<L, EP, seedBytes>()> pkey;
+
+  inline explicit pkey_stream_t(std::span<const uint8_t, saber_utils::pke_pklen<L, EP, seedBytes>()> bytes)
+    : pkey(bytes)
+  {
+  }
+
+  // Given secret vector s' ( in evaluation domain ), computes A * s', expanding A on the
+  // fly.
+  template<uint16_t moduli>
+  inline mat::poly_matrix_t<L, 1, moduli> mat_vec_mul(const mat::poly_matrix_eval_t<L, 1, domain_t>& s_prm) const
+  {
+    return mat::poly_matrix_t<L, L, (1u << EQ)>::template gen_matrix_vec_mul<seedBytes>(pkey.template last<seedBytes>(), s_prm);
+  }
+
+  // Given secret vector s' ( in evaluation domain ), unpacks b and computes b^T * s'.
+  template<uint16_t moduli>
+  inline poly::poly_t<moduli> inner_prod(const mat::poly_matrix_eval_t<L, 1, domain_t>& s_prm) const
+  {
+    const mat::poly_matrix_t<L, 1, (1u << EP)> b(pkey.template first<saber_utils::pke_pklen<L, EP, seedBytes>() - seedBytes>());
+    return b.template evaluate<domain_t>().template inner_prod<moduli>(s_prm);
+  }
+};
+
+// Saber PKE secret key, in evaluation domain of polynomial multiplier i.e. secret vector
+// s is transformed only once and kept in memory, so that each decryption only needs to
+// evaluate the received vector b'.
+template<size_t L, size_t EQ>
+struct skey_eval_t
+{
+  mat::poly_matrix_eval_t<L, 1, domain_t> s;
+
+  // Given a Saber PKE secret key, this routine unpacks secret vector s and transforms it
+  // into evaluation domain.
+  inline explicit skey_eval_t(std::span<const uint8_t, saber_utils::pke_sklen<L, EQ>()> skey)
+    : s(mat::poly_matrix_t<L, 1, (1u << EQ)>(skey))
+  {
+  }
+};
+
+// Given 32 -bytes input message, seedBytes -bytes `seedS` and Saber PKE public key ( either
+// in evaluation domain, see `pkey_eval_t`, or streamed, see `pkey_stream_t` ), this
+// routine can be used for encrypting fixed length message using Saber public key
+// encryption algorithm, computing a cipher text. This routine is an implementation of
+// algorithm 18 in section 8.4.2 of Saber spec. Secret vector s' is evaluated only once,
+// for computing both A * s' and b^T * s'.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, bool uniform_sampling, typename PK>
+inline void
+encrypt(std::span<const uint8_t, 32> msg,
+        std::span<const uint8_t, seedBytes> seedS,
+        const PK& pkey,
+        std::span<uint8_t, saber_utils::pke_ctlen<L, EP, ET>()> ctxt)
+  requires(saber_params::validate_pke_encrypt_args(L, EQ, EP, ET, MU, seedBytes, uniform_sampling) &&
+           (std::same_as<PK, pkey_eval_t<L, EQ, EP, seedBytes>> || std::same_as<PK, pkey_stream_t<L, EQ, EP, seedBytes>>))
+{
+  constexpr uint16_t Q = 1u << EQ;
+  constexpr uint16_t P = 1u << EP;
+  constexpr uint16_t T = 1u << ET;
+
+  constexpr uint16_t h1 = saber_consts::compute_h1<EQ, EP>();
+
+  constexpr size_t b_prm_p_len = (L * EP * poly::N) / 8;
+  constexpr size_t c_m_len = (ET * poly::N) / 8;
+  static_assert(b_prm_p_len + c_m_len == ctxt.size(), "Cipher text size must match !");
+
+  auto ctxt_ct = ctxt.template subspan<0, b_prm_p_len>();
+  auto ctxt_cm = ctxt.template subspan<ctxt_ct.size(), c_m_len>();
+
+  // step 3
+  auto s_prm = mat::poly_matrix_t<L, 1, Q>::template gen_secret<uniform_sampling, seedBytes, MU>(seedS);
+  auto s_prm_hat = s_prm.template evaluate<domain_t>();
+
+  // step 4, 5, 6 and step 7, 8 are independent of each other, see `parallel::for_each`
+  mat::poly_matrix_t<L, 1, Q> b_prm;
+  poly::poly_t<P> v_prm;
+
+  parallel::for_each(2, [&](const size_t t) {
+    if (t == 0) {
+      b_prm = pkey.template mat_vec_mul<Q>(s_prm_hat);
+    } else {
+      v_prm = pkey.template inner_prod<P>(s_prm_hat);
+    }
+  });
+
+  // step 12 ( partial ), rounding fused with serialization
+  b_prm.template round_to_bytes<P, EQ - EP>(h1, ctxt_ct);
+
+  // step 9, message is kept as a bitset, read directly by fused rounding kernel
+  poly::poly1_t m(msg);
+
+  // step 10, 11, 12 ( partial ), encoding of message and rounding fused with serialization
+  v_prm.template sub_round_to_bytes<T, EP - ET, EP - 1>(m, h1, ctxt_cm);
+}
+
 // Given 32 -bytes input message, seedBytes -bytes `seedS` and Saber PKE public key,
 // this routine can be used for encrypting fixed length message using Saber public key
 // encryption algorithm, computing a cipher text. This routine is an implementation of
@@ -64,56 +270,111 @@ encrypt(std::span<const uint8_t, 32> msg,
         std::span<const uint8_t, saber_utils::pke_pklen<L, EP, seedBytes>()> pkey,
         std::span<uint8_t, saber_utils::pke_ctlen<L, EP, ET>()> ctxt)
   requires(saber_params::validate_pke_encrypt_args(L, EQ, EP, ET, MU, seedBytes, uniform_sampling))
+{
+  // step 1, 2, matrix A is expanded on the fly
+  const pkey_stream_t<L, EQ, EP, seedBytes> pkey_stream(pkey);
+  encrypt<L, EQ, EP, ET, MU, seedBytes, uniform_sampling>(msg, seedS, pkey_stream, ctxt);
+}
+
+// Batched variant of `encrypt`, encrypting i-th 32 -bytes message, using i-th `seedS`,
+// under i-th Saber PKE public key ( in its serialized form ), for all i ∈ [0, lanes).
+// Secret vectors s' and matrices A are expanded by multi-buffer SHAKE128, while each
+// matrix is multiplied while being expanded, see `poly_matrix_t::gen_matrix_vec_mul_batch`.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, bool uniform_sampling, size_t lanes>
+inline void
+encrypt_batch(std::array<std::span<const uint8_t>, lanes> msg,
+              std::array<std::span<const uint8_t>, lanes> seedS,
+              std::array<std::span<const uint8_t>, lanes> pkey,
+              std::array<std::span<uint8_t>, lanes> ctxt)
+  requires(saber_params::validate_pke_encrypt_args(L, EQ, EP, ET, MU, seedBytes, uniform_sampling))
 {
   constexpr uint16_t Q = 1u << EQ;
   constexpr uint16_t P = 1u << EP;
   constexpr uint16_t T = 1u << ET;
 
-  constexpr auto h1 = saber_consts::compute_poly_h1<Q, EQ, EP>();
-  constexpr auto h = saber_consts::compute_polyvec_h<L, Q, EQ, EP>();
+  constexpr uint16_t h1 = saber_consts::compute_h1<EQ, EP>();
 
-  // step 1
-  auto pk = pkey.template subspan<0, pkey.size() - seedBytes>();
-  auto seedA = pkey.template subspan<pk.size(), seedBytes>();
+  constexpr size_t pklen = saber_utils::pke_pklen<L, EP, seedBytes>();
+  constexpr size_t b_prm_p_len = (L * EP * poly::N) / 8;
+  constexpr size_t c_m_len = (ET * poly::N) / 8;
 
-  // step 2, 3
-  auto A = mat::poly_matrix_t<L, L, Q>::template gen_matrix<seedBytes>(seedA);
-  auto s_prm = mat::poly_matrix_t<L, 1, Q>::template gen_secret<uniform_sampling, seedBytes, MU>(seedS);
+  // step 3
+  const auto s_prm = mat::poly_matrix_t<L, 1, Q>::template gen_secret_batch<uniform_sampling, MU, lanes>(seedS);
 
-  // step 4, 5, 6
-  auto b_prm = A.template mat_vec_mul<L>(s_prm) + h;
-  auto b_prm_p = (b_prm >> (EQ - EP)).template mod<P>();
+  std::array<mat::poly_matrix_eval_t<L, 1, domain_t>, lanes> s_prm_hat;
+  std::array<std::span<const uint8_t>, lanes> seedA;
 
-  // step 7, 8
-  mat::poly_matrix_t<L, 1, P> b(pk);
-  auto s_prm_p = s_prm.template mod<P>();
-  auto v_prm = b.inner_prod(s_prm_p);
+  for (size_t k = 0; k < lanes; k++) {
+    s_prm_hat[k] = s_prm[k].template evaluate<domain_t>();
+    seedA[k] = pkey[k].last(seedBytes);
+  }
 
-  // step 9, 10
-  poly::poly_t<2> m(msg);
-  auto m_p = (m << (EP - 1)).template mod<P>();
+  // step 1, 2, 4, 5, 6
+  const auto b_prm = mat::poly_matrix_t<L, L, Q>::template gen_matrix_vec_mul_batch<false, lanes>(seedA, s_prm_hat);
 
-  // step 11
-  auto c_m = (v_prm - m_p + (h1.template mod<P>())) >> (EP - ET);
+  for (size_t k = 0; k < lanes; k++) {
+    // step 12 ( partial ), rounding fused with serialization
+    b_prm[k].template round_to_bytes<P, EQ - EP>(h1, ctxt[k].first(b_prm_p_len));
 
-  // step 12
-  constexpr size_t b_prm_p_len = (L * EP * poly::N) / 8;
-  constexpr size_t c_m_len = (ET * poly::N) / 8;
-  static_assert(b_prm_p_len + c_m_len == ctxt.size(), "Cipher text size must match !");
+    // step 7, 8
+    const mat::poly_matrix_t<L, 1, P> b(pkey[k].first(pklen - seedBytes));
+    auto v_prm = b.template evaluate<domain_t>().template inner_prod<P>(s_prm_hat[k]);
 
-  auto ctxt_ct = ctxt.template subspan<0, b_prm_p_len>();
-  auto ctxt_cm = ctxt.template subspan<ctxt_ct.size(), c_m_len>();
+    // step 9
+    poly::poly1_t m(msg[k].template first<poly::N / 8>());
+
+    // step 10, 11, 12 ( partial )
+    v_prm.template sub_round_to_bytes<T, EP - ET, EP - 1>(m, h1, ctxt[k].subspan(b_prm_p_len, c_m_len));
+  }
+}
+
+// Given Saber PKE cipher text and Saber PKE secret key ( in evaluation domain ), this
+// routine can be used for decrypting the cipher text to 32 -bytes plain text message,
+// which was encrypted using corresponding ( associated with this secret key ) Saber PKE
+// public key. This routine is an implementation of algorithm 19 in section 8.4.3 of
+// Saber spec.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, bool uniform_sampling>
+inline void
+decrypt(std::span<const uint8_t, saber_utils::pke_ctlen<L, EP, ET>()> ctxt, const skey_eval_t<L, EQ>& skey, std::span<uint8_t, 32> msg)
+  requires(saber_params::validate_pke_decrypt_args(L, EQ, EP, ET, MU, uniform_sampling))
+{
+  constexpr uint16_t P = 1u << EP;
+  constexpr uint16_t T = 1u << ET;
+
+  constexpr uint16_t h2 = saber_consts::compute_h2<EQ, EP, ET>();
+
+  // step 3
+  constexpr size_t ct_len = (L * EP * poly::N) / 8;
+  constexpr size_t cm_len = (ET * poly::N) / 8;
+  static_assert(ct_len + cm_len == ctxt.size(), "Cipher text size must match !");
+
+  auto ctxt_ct = ctxt.template subspan<0, ct_len>();
+  auto ctxt_cm = ctxt.template subspan<ct_len, cm_len>();
 
-  b_prm_p.to_bytes(ctxt_ct);
-  (c_m.template mod<T>()).to_bytes(ctxt_cm);
+  // step 4, coefficients are kept in 8 -bit lanes
+  poly::poly8_t<T> c_m(ctxt_cm);
+
+  // step 6
+  mat::poly_matrix_t<L, 1, P> b_prm(ctxt_ct);
+
+  // step 7
+  auto v = b_prm.template evaluate<domain_t>().template inner_prod<P>(skey.s);
+
+  // step 5, 8, 9, rounding fused with serialization
+  v.template sub_round_to_bytes<2, EP - 1, EP - ET>(c_m, h2, msg);
 }
 
 // Given Saber PKE cipher text and Saber PKE secret key, this routine can be used for
 // decrypting the cipher text to 32 -bytes plain text message, which was encrypted using
 // corresponding ( associated with this secret key ) Saber PKE public key. This routine
 // is an implementation of algorithm 19 in section 8.4.3 of Saber spec.
+//
+// Secret vector s and vector b' are unpacked and evaluated one polynomial at a time,
+// while being multiplied, so that neither of them is materialized. It's never inlined, so
+// that its frame is gone before one-shot decapsulation re-encrypts, keeping stack usage
+// of decapsulation close to that of encapsulation.
 template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, bool uniform_sampling>
-inline void
+__attribute__((noinline)) inline void
 decrypt(std::span<const uint8_t, saber_utils::pke_ctlen<L, EP, ET>()> ctxt, std::span<const uint8_t, saber_utils::pke_sklen<L, EQ>()> skey, std::span<uint8_t, 32> msg)
   requires(saber_params::validate_pke_decrypt_args(L, EQ, EP, ET, MU, uniform_sampling))
 {
@@ -121,32 +382,40 @@ decrypt(std::span<const uint8_t, saber_utils::pke_ctlen<L, EP, ET>()> ctxt, std:
   constexpr uint16_t P = 1u << EP;
   constexpr uint16_t T = 1u << ET;
 
-  constexpr auto h2 = saber_consts::compute_poly_h2<Q, EQ, EP, ET>();
-
-  // step 2
-  mat::poly_matrix_t<L, 1, Q> s(skey);
+  constexpr uint16_t h2 = saber_consts::compute_h2<EQ, EP, ET>();
 
   // step 3
   constexpr size_t ct_len = (L * EP * poly::N) / 8;
   constexpr size_t cm_len = (ET * poly::N) / 8;
   static_assert(ct_len + cm_len == ctxt.size(), "Cipher text size must match !");
 
+  constexpr size_t s_blen = (EQ * poly::N) / 8;
+  constexpr size_t b_blen = (EP * poly::N) / 8;
+
   auto ctxt_ct = ctxt.template subspan<0, ct_len>();
   auto ctxt_cm = ctxt.template subspan<ct_len, cm_len>();
 
-  // step 4, 5
-  poly::poly_t<T> c_m(ctxt_cm);
-  c_m = c_m << (EP - ET);
+  // step 2, 6, 7
+  alignas(poly::ALIGNMENT) domain_t::prod_t acc{};
 
-  // step 6
-  mat::poly_matrix_t<L, 1, P> b_prm(ctxt_ct);
+  for (size_t i = 0; i < L; i++) {
+    const poly::poly_t<Q> s(skey.subspan(i * s_blen, s_blen));
+    const poly::poly_t<P> b_prm(ctxt_ct.subspan(i * b_blen, b_blen));
 
-  // step 7, 8
-  auto v = b_prm.inner_prod(s.template mod<P>());
-  auto m_p = (v - c_m.template mod<P>() + h2.template mod<P>()) >> (EP - 1);
+    alignas(poly::ALIGNMENT) zq::uninit_t<domain_t::eval_t> s_hat;
+    alignas(poly::ALIGNMENT) zq::uninit_t<domain_t::eval_t> b_prm_hat;
 
-  // step 9
-  (m_p.template mod<2>()).to_bytes(msg);
+    domain_t::evaluate<Q>(s.as_array(), s_hat.v);
+    domain_t::evaluate<P>(b_prm.as_array(), b_prm_hat.v);
+    domain_t::mul_acc(acc, b_prm_hat.v, s_hat.v);
+  }
+  const poly::poly_t<P> v = domain_t::interpolate(acc);
+
+  // step 4, coefficients are kept in 8 -bit lanes
+  poly::poly8_t<T> c_m(ctxt_cm);
+
+  // step 5, 8, 9, rounding fused with serialization
+  v.template sub_round_to_bytes<2, EP - 1, EP - ET>(c_m, h2, msg);
 }
 
 }
@@ -0,0 +1,124 @@
+#pragma once
+#include "bitpack.hpp"
+#include "dispatch.hpp"
+#include "params.hpp"
+#include "polynomial.hpp"
+#include <array>
+#include <cstring>
+#include <span>
+
+// Compact storage for polynomials over small rings, which otherwise spend 16 -bits on
+// each coefficient, while carrying only a few bits of information.
+namespace poly {
+
+// Polynomial over Rq = Zq[X]/(X^N + 1) s.t. q <= 2^8 ( such as Rt, holding cipher text
+// message polynomial c_m ), whose coefficients are stored in 8 -bit lanes, taking N
+// -bytes, instead of 2 * N -bytes taken by `poly_t`.
+template<uint16_t moduli>
+  requires(saber_params::is_power_of_2(moduli) && (moduli <= (1u << 8)))
+struct poly8_t
+{
+private:
+  alignas(ALIGNMENT) std::array<uint8_t, N> coeffs;
+
+public:
+  static constexpr uint16_t MODULI = moduli;
+
+  // Constructors
+  inline constexpr poly8_t() = default;
+
+  // Narrows coefficients of a polynomial to 8 -bit lanes. Each coefficient is kept
+  // modulo 2^8, which is congruent to it modulo `moduli`.
+  inline constexpr explicit poly8_t(const poly_t<moduli>& poly)
+  {
+    for (size_t i = 0; i < N; i++) {
+      coeffs[i] = static_cast<uint8_t>(poly[i].as_raw());
+    }
+  }
+
+  // Given a byte string of length log2(moduli) * 32 -bytes, this routine unpacks it
+  // into a polynomial, same as `poly_t`, but straight into 8 -bit lanes, using BMI2,
+  // when available on the CPU.
+  inline explicit poly8_t(std::span<const uint8_t> bstr)
+    requires(saber_params::validate_poly_serialization_args<moduli>())
+  {
+    constexpr size_t lg2_moduli = saber_params::log2(moduli);
+
+#if defined SABER_DISPATCH
+    if (dispatch::has_bmi2()) {
+      bitpack::unpack_u8_bmi2<lg2_moduli>(bstr, coeffs);
+      return;
+    }
+#endif
+
+    bitpack::unpack_u8<lg2_moduli>(bstr, coeffs);
+  }
+
+  // Returns coefficient at given polynomial index ∈ [0, N).
+  inline constexpr zq::zq_t operator[](const size_t idx) const { return coeffs[idx]; }
+
+  // Returns const reference to underlying array of 8 -bit coefficients.
+  inline constexpr const std::array<uint8_t, N>& as_array() const { return coeffs; }
+
+  // Widens coefficients back to 16 -bit elements of Zq.
+  inline constexpr poly_t<moduli> to_poly() const
+  {
+    poly_t<moduli> res;
+    for (size_t i = 0; i < N; i++) {
+      res[i] = coeffs[i];
+    }
+    return res;
+  }
+};
+
+// Polynomial over R2 = Z2[X]/(X^N + 1) ( such as the message, being encrypted ), whose
+// coefficients are stored as a bitset of N / 8 -bytes. i-th coefficient is bit ( i mod 8 )
+// of byte ⌊i / 8⌋, which is exactly how `poly_t<2>` is serialized, so that conversion to
+// and from a byte string is a plain copy.
+struct poly1_t
+{
+private:
+  std::array<uint8_t, N / 8> bits;
+
+public:
+  static constexpr uint16_t MODULI = 2;
+
+  // Constructors
+  inline constexpr poly1_t() = default;
+
+  // Keeps lowest bit of each coefficient of a polynomial.
+  inline constexpr explicit poly1_t(const poly_t<2>& poly)
+  {
+    for (size_t i = 0; i < N / 8; i++) {
+      uint8_t byte = 0;
+      for (size_t j = 0; j < 8; j++) {
+        byte |= static_cast<uint8_t>((poly[i * 8 + j].as_raw() & 1) << j);
+      }
+      bits[i] = byte;
+    }
+  }
+
+  // Given a byte string of length 32 -bytes, this routine interprets it as a polynomial.
+  inline explicit poly1_t(std::span<const uint8_t, N / 8> bstr) { std::memcpy(bits.data(), bstr.data(), bstr.size()); }
+
+  // Returns coefficient at given polynomial index ∈ [0, N).
+  inline constexpr zq::zq_t operator[](const size_t idx) const { return static_cast<uint16_t>((bits[idx / 8] >> (idx % 8)) & 1); }
+
+  // Returns const reference to underlying bitset.
+  inline constexpr const std::array<uint8_t, N / 8>& as_array() const { return bits; }
+
+  // Widens coefficients back to 16 -bit elements of Z2.
+  inline constexpr poly_t<2> to_poly() const
+  {
+    poly_t<2> res;
+    for (size_t i = 0; i < N; i++) {
+      res[i] = (*this)[i];
+    }
+    return res;
+  }
+
+  // Serializes polynomial into a byte string of length 32 -bytes.
+  inline void to_bytes(std::span<uint8_t, N / 8> bstr) const { std::memcpy(bstr.data(), bits.data(), bits.size()); }
+};
+
+}
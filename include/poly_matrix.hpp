@@ -1,5 +1,9 @@
 #pragma once
+#include "keccak_batch.hpp"
+#include "parallel.hpp"
 #include "params.hpp"
+#include "polymul.hpp"
+#include "polymul_batch.hpp"
 #include "polynomial.hpp"
 #include "sampling.hpp"
 #include "shake128.hpp"
@@ -7,21 +11,248 @@
 // Operations defined over matrix/ vector of polynomials.
 namespace mat {
 
+// Matrix/ vector of polynomials, in evaluation domain of a polynomial multiplier ( see
+// `polymul::domain_t` and `smallmul::domain_t` ).
+template<size_t rows, size_t cols, typename D = polymul::domain_t>
+struct poly_matrix_eval_t;
+
+template<size_t rows, size_t cols, uint16_t moduli>
+struct poly_matrix_t;
+
+// Matrix/ vector of polynomials or a lazily evaluated, element-wise expression over
+// them, which can be indexed to get ( an expression computing ) requested element.
+template<typename T>
+concept matrix_like = requires(const std::remove_cvref_t<T>& t, const size_t idx) {
+  { std::remove_cvref_t<T>::ROWS } -> std::convertible_to<size_t>;
+  { std::remove_cvref_t<T>::COLS } -> std::convertible_to<size_t>;
+  { std::remove_cvref_t<T>::MODULI } -> std::convertible_to<uint16_t>;
+  { t[idx] } -> poly::poly_like;
+};
+
+template<typename T>
+struct is_matrix : std::false_type
+{};
+
+template<size_t rows, size_t cols, uint16_t moduli>
+struct is_matrix<poly_matrix_t<rows, cols, moduli>> : std::true_type
+{};
+
+// Lazily evaluated expression over matrices, which is not itself a matrix.
+template<typename T>
+concept matrix_expr = matrix_like<T> && !is_matrix<std::remove_cvref_t<T>>::value;
+
+// How an operand is held by a lazy matrix expression, see `poly::operand_t`.
+template<typename T>
+using operand_t = std::conditional_t<std::is_lvalue_reference_v<T> && is_matrix<std::remove_cvref_t<T>>::value,
+                                     const std::remove_cvref_t<T>&,
+                                     std::remove_cvref_t<T>>;
+
+// Common interface of lazy, element-wise expressions over matrices of dimension
+// rows x cols, whose elements are polynomials over Zq s.t. q = moduli. Indexing an
+// expression yields a lazy polynomial expression, so that each element is computed in a
+// single pass, only when the expression is assigned to a matrix or serialized.
+template<typename E, size_t rows, size_t cols, uint16_t moduli>
+struct matrix_expr_t
+{
+  static constexpr size_t ROWS = rows;
+  static constexpr size_t COLS = cols;
+  static constexpr uint16_t MODULI = moduli;
+
+  // Change moduli of each element of expression to a different value, lazily.
+  template<uint16_t new_moduli>
+  inline constexpr auto mod() const
+    requires(moduli != new_moduli);
+
+  // Evaluates expression, materializing a matrix.
+  inline constexpr poly_matrix_t<rows, cols, moduli> eval() const { return poly_matrix_t<rows, cols, moduli>(static_cast<const E&>(*this)); }
+
+  // Evaluates vector expression and serializes it, one element polynomial at a time, see
+  // `poly_matrix_t::to_bytes`.
+  inline void to_bytes(std::span<uint8_t> bstr) const
+    requires(cols == 1)
+  {
+    constexpr size_t poly_blen = poly::N * saber_params::log2(moduli) / 8;
+    for (size_t i = 0; i < rows; i++) {
+      poly::poly_t<moduli>(static_cast<const E&>(*this)[i]).to_bytes(bstr.subspan(i * poly_blen, poly_blen));
+    }
+  }
+};
+
+// Lazy element-wise addition of two matrices.
+template<typename Op, typename Lhs, typename Rhs>
+struct matrix_binary_expr_t
+  : matrix_expr_t<matrix_binary_expr_t<Op, Lhs, Rhs>, std::remove_cvref_t<Lhs>::ROWS, std::remove_cvref_t<Lhs>::COLS, std::remove_cvref_t<Lhs>::MODULI>
+{
+  Lhs lhs;
+  Rhs rhs;
+
+  template<typename L, typename R>
+  inline constexpr matrix_binary_expr_t(L&& l, R&& r)
+    : lhs(std::forward<L>(l))
+    , rhs(std::forward<R>(r))
+  {
+  }
+
+  inline constexpr auto operator[](const size_t idx) const { return Op{}(lhs[idx], rhs[idx]); }
+};
+
+// Lazy left/ right shift of each element of a matrix.
+template<typename Op, typename Arg>
+struct matrix_shift_expr_t
+  : matrix_expr_t<matrix_shift_expr_t<Op, Arg>, std::remove_cvref_t<Arg>::ROWS, std::remove_cvref_t<Arg>::COLS, std::remove_cvref_t<Arg>::MODULI>
+{
+  Arg arg;
+  size_t off;
+
+  template<typename T>
+  inline constexpr matrix_shift_expr_t(T&& a, const size_t o)
+    : arg(std::forward<T>(a))
+    , off(o)
+  {
+  }
+
+  inline constexpr auto operator[](const size_t idx) const { return Op{}(arg[idx], off); }
+};
+
+// Lazy change of moduli of each element of a matrix.
+template<uint16_t new_moduli, typename Arg>
+struct matrix_mod_expr_t
+  : matrix_expr_t<matrix_mod_expr_t<new_moduli, Arg>, std::remove_cvref_t<Arg>::ROWS, std::remove_cvref_t<Arg>::COLS, new_moduli>
+{
+  Arg arg;
+
+  template<typename T>
+  inline constexpr explicit matrix_mod_expr_t(T&& a)
+    : arg(std::forward<T>(a))
+  {
+  }
+
+  inline constexpr auto operator[](const size_t idx) const { return arg[idx].template mod<new_moduli>(); }
+};
+
+template<typename E, size_t rows, size_t cols, uint16_t moduli>
+template<uint16_t new_moduli>
+inline constexpr auto
+matrix_expr_t<E, rows, cols, moduli>::mod() const
+  requires(moduli != new_moduli)
+{
+  return matrix_mod_expr_t<new_moduli, E>(static_cast<const E&>(*this));
+}
+
+// Adds two polynomial matrices/ vectors of equal dimension, lazily.
+template<typename L, typename R>
+  requires(matrix_like<L> && matrix_like<R> && (std::remove_cvref_t<L>::ROWS == std::remove_cvref_t<R>::ROWS) &&
+           (std::remove_cvref_t<L>::COLS == std::remove_cvref_t<R>::COLS) && (std::remove_cvref_t<L>::MODULI == std::remove_cvref_t<R>::MODULI))
+inline constexpr auto
+operator+(L&& lhs, R&& rhs)
+{
+  return matrix_binary_expr_t<poly::add_op_t, operand_t<L>, operand_t<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+}
+
+// Left shift each element of the polynomial matrix by factor `off`, lazily.
+template<typename T>
+  requires(matrix_like<T>)
+inline constexpr auto
+operator<<(T&& arg, const size_t off)
+{
+  return matrix_shift_expr_t<poly::shl_op_t, operand_t<T>>(std::forward<T>(arg), off);
+}
+
+// Right shift each element of the polynomial matrix by factor `off`, lazily.
+template<typename T>
+  requires(matrix_like<T>)
+inline constexpr auto
+operator>>(T&& arg, const size_t off)
+{
+  return matrix_shift_expr_t<poly::shr_op_t, operand_t<T>>(std::forward<T>(arg), off);
+}
+
 // Wrapper type encapsulating matrix/ vector operations s.t. its elements are
 // polynomials in Rq = Zq[X]/(X^N + 1), N = 256.
 template<size_t rows, size_t cols, uint16_t moduli>
 struct poly_matrix_t
 {
 private:
-  std::array<poly::poly_t<moduli>, rows * cols> elements{};
+  std::array<poly::poly_t<moduli>, rows * cols> elements;
 
 public:
+  static constexpr size_t ROWS = rows;
+  static constexpr size_t COLS = cols;
+  static constexpr uint16_t MODULI = moduli;
+
   // Constructors
   inline constexpr poly_matrix_t() = default;
-  inline constexpr poly_matrix_t(std::array<poly::poly_t<moduli>, rows * cols>& arr) { elements = arr; }
-  inline constexpr poly_matrix_t(std::array<poly::poly_t<moduli>, rows * cols>&& arr) { elements = arr; }
-  inline constexpr poly_matrix_t(const std::array<poly::poly_t<moduli>, rows * cols>& arr) { elements = arr; }
-  inline constexpr poly_matrix_t(const std::array<poly::poly_t<moduli>, rows * cols>&& arr) { elements = arr; }
+  inline constexpr poly_matrix_t(const std::array<poly::poly_t<moduli>, rows * cols>& arr)
+    : elements(arr)
+  {
+  }
+
+  // Evaluates a lazy expression over matrices, in a single pass over coefficients of each
+  // element polynomial.
+  template<typename E>
+    requires(matrix_expr<E> && (E::ROWS == rows) && (E::COLS == cols) && (E::MODULI == moduli))
+  inline constexpr poly_matrix_t(const E& expr)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      elements[i] = expr[i];
+    }
+  }
+
+  // Evaluates a lazy expression over matrices, overwriting elements of this matrix. As
+  // operations are element-wise, expression may refer to this matrix itself.
+  template<typename E>
+    requires(matrix_expr<E> && (E::ROWS == rows) && (E::COLS == cols) && (E::MODULI == moduli))
+  inline constexpr poly_matrix_t& operator=(const E& expr)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      elements[i] = expr[i];
+    }
+    return *this;
+  }
+
+  // In-place, element-wise addition of a matrix ( or a lazy expression over matrices ) of
+  // same dimension to this matrix. No temporary matrix is materialized.
+  template<typename E>
+    requires(matrix_like<E> && (std::remove_cvref_t<E>::ROWS == rows) && (std::remove_cvref_t<E>::COLS == cols) &&
+             (std::remove_cvref_t<E>::MODULI == moduli))
+  inline constexpr poly_matrix_t& operator+=(const E& rhs)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      elements[i] += rhs[i];
+    }
+    return *this;
+  }
+
+  // In-place, element-wise subtraction of a matrix ( or a lazy expression over matrices )
+  // of same dimension from this matrix.
+  template<typename E>
+    requires(matrix_like<E> && (std::remove_cvref_t<E>::ROWS == rows) && (std::remove_cvref_t<E>::COLS == cols) &&
+             (std::remove_cvref_t<E>::MODULI == moduli))
+  inline constexpr poly_matrix_t& operator-=(const E& rhs)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      elements[i] -= rhs[i];
+    }
+    return *this;
+  }
+
+  // In-place left shift of each element of this matrix by factor `off`.
+  inline constexpr poly_matrix_t& operator<<=(const size_t off)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      elements[i] <<= off;
+    }
+    return *this;
+  }
+
+  // In-place right shift of each element of this matrix by factor `off`.
+  inline constexpr poly_matrix_t& operator>>=(const size_t off)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      elements[i] >>= off;
+    }
+    return *this;
+  }
 
   // Given linearized matrix index, returns reference to requested element polynomial.
   // `idx` must ∈ [0, rows * cols).
@@ -52,59 +283,28 @@ public:
     }
   }
 
-  // Adds two polynomial matrices/ vectors of equal dimension.
-  inline constexpr poly_matrix_t<rows, cols, moduli> operator+(const poly_matrix_t<rows, cols, moduli>& rhs) const
-  {
-    std::array<poly::poly_t<moduli>, rows * cols> res{};
-
-    for (size_t i = 0; i < rows * cols; i++) {
-      res[i] = elements[i] + rhs.elements[i];
-    }
-
-    return res;
-  }
-
-  // Left shift each element of the polynomial matrix by factor `off`.
-  inline constexpr poly_matrix_t<rows, cols, moduli> operator<<(const size_t off) const
-  {
-    std::array<poly::poly_t<moduli>, rows * cols> res{};
-
-    for (size_t i = 0; i < rows * cols; i++) {
-      res[i] = elements[i] << off;
-    }
-
-    return res;
-  }
-
-  // Right shift each element of the polynomial matrix by factor `off`.
-  inline constexpr poly_matrix_t<rows, cols, moduli> operator>>(const size_t off) const
+  // Change moduli of each element of polynomial matrix to a different value, lazily.
+  // Result refers to this matrix, so it must be evaluated before this matrix goes out of
+  // scope.
+  template<uint16_t new_moduli>
+  inline constexpr auto mod() const&
+    requires(moduli != new_moduli)
   {
-    std::array<poly::poly_t<moduli>, rows * cols> res{};
-
-    for (size_t i = 0; i < rows * cols; i++) {
-      res[i] = elements[i] >> off;
-    }
-
-    return res;
+    return matrix_mod_expr_t<new_moduli, const poly_matrix_t&>(*this);
   }
 
-  // Change moduli of each element of polynomial matrix to a different value.
+  // Change moduli of each element of a temporary polynomial matrix to a different value,
+  // lazily, taking over its elements.
   template<uint16_t new_moduli>
-  inline constexpr poly_matrix_t<rows, cols, new_moduli> mod() const
+  inline constexpr auto mod() &&
     requires(moduli != new_moduli)
   {
-    std::array<poly::poly_t<new_moduli>, rows * cols> res{};
-
-    for (size_t i = 0; i < rows * cols; i++) {
-      res[i] = std::move(elements[i].template mod<new_moduli>());
-    }
-
-    return res;
+    return matrix_mod_expr_t<new_moduli, poly_matrix_t>(std::move(*this));
   }
 
   // Given a vector of polynomials, this routine can transform it into a byte
   // string of length rows * log2(moduli) * 32, following algorithm 12 of spec.
-  inline void to_bytes(std::span<uint8_t> bstr)
+  inline void to_bytes(std::span<uint8_t> bstr) const
     requires(cols == 1)
   {
     constexpr size_t poly_blen = poly::N * saber_params::log2(moduli) / 8;
@@ -113,39 +313,72 @@ public:
     }
   }
 
+  // Given a rounding constant `rc`, this routine computes ((v_i + rc) >> off) mod
+  // new_moduli, for each element polynomial v_i of this vector, and serializes result
+  // into a byte string of length rows * log2(new_moduli) * 32, without materializing
+  // intermediate vectors, see `poly_t::round_to_bytes`.
+  template<uint16_t new_moduli, size_t off>
+  inline void round_to_bytes(const uint16_t rc, std::span<uint8_t> bstr) const
+    requires(cols == 1)
+  {
+    constexpr size_t poly_blen = poly::N * saber_params::log2(new_moduli) / 8;
+    for (size_t i = 0; i < rows; i++) {
+      elements[i].template round_to_bytes<new_moduli, off>(rc, bstr.subspan(i * poly_blen, poly_blen));
+    }
+  }
+
   // Given a matrix M ∈ Rq^(l×l) and vector v ∈ Rq^(l×1), this routine performs
   // a matrix vector multiplication, returning a vector mv ∈ Rq^(l×1), following
   // algorithm 13 of spec.
+  //
+  // Each polynomial of vector is evaluated only once and reused across all rows of the
+  // matrix, while row-wise products are accumulated in evaluation domain, so that
+  // interpolation is performed only once per output polynomial.
   template<size_t rhs_rows>
   inline poly_matrix_t<rows, 1, moduli> mat_vec_mul(const poly_matrix_t<rhs_rows, 1, moduli>& vec)
-    requires((rows == cols) && (cols == rhs_rows))
+    requires((rows == cols) && (cols == rhs_rows) && (moduli <= polymul::MAX_MODULI))
   {
     poly_matrix_t<rows, 1, moduli> res;
 
-    for (size_t i = 0; i < rows; i++) {
-      poly::poly_t<moduli> poly;
+    alignas(poly::ALIGNMENT) zq::uninit_t<std::array<polymul::eval_t, rhs_rows>> vec_hat;
+    for (size_t j = 0; j < cols; j++) {
+      polymul::evaluate(vec[j].as_array(), vec_hat.v[j]);
+    }
+
+    // rows are independent, see `parallel::for_each`
+    parallel::for_each(rows, [&](const size_t i) {
+      alignas(poly::ALIGNMENT) polymul::prod_t acc{};
 
       for (size_t j = 0; j < cols; j++) {
-        poly += ((*this)[{ i, j }] * vec[{ j, 0 }]);
+        polymul::mul_acc(acc, polymul::evaluate((*this)[{ i, j }].as_array()), vec_hat.v[j]);
       }
-      res[i] = poly;
-    }
+      res[i] = polymul::interpolate(acc);
+    });
 
     return res;
   }
 
   // Given two vectors v_a, v_b ∈ Rp^(l×1), this routine computes their inner
   // product, returning a polynomial c ∈ Rp, following algorithm 14 of spec.
+  // Products are accumulated in evaluation domain and interpolated only once.
   inline poly::poly_t<moduli> inner_prod(const poly_matrix_t<rows, cols, moduli>& vec)
-    requires(cols == 1)
+    requires((cols == 1) && (moduli <= polymul::MAX_MODULI))
   {
-    poly::poly_t<moduli> res;
+    alignas(poly::ALIGNMENT) polymul::prod_t acc{};
 
     for (size_t i = 0; i < rows; i++) {
-      res += (this->elements[i] * vec.elements[i]);
+      polymul::mul_acc(acc, polymul::evaluate(this->elements[i].as_array()), polymul::evaluate(vec.elements[i].as_array()));
     }
 
-    return res;
+    return polymul::interpolate(acc);
+  }
+
+  // Transforms each element polynomial of matrix/ vector into evaluation domain of
+  // polynomial multiplier, so that it can be reused across many multiplications.
+  template<typename D = polymul::domain_t>
+  inline poly_matrix_eval_t<rows, cols, D> evaluate() const
+  {
+    return poly_matrix_eval_t<rows, cols, D>(*this);
   }
 
   // Given random byte string ( seed ) of length `seedBytes` as input,
@@ -161,7 +394,7 @@ public:
 
     poly_matrix_t<rows, cols, moduli> mat;
 
-    std::array<uint8_t, buf_blen> buf{};
+    std::array<uint8_t, buf_blen> buf;
     auto bufs = std::span<uint8_t, buf_blen>(buf);
 
     shake128::shake128_t hasher;
@@ -179,6 +412,150 @@ public:
     return mat;
   }
 
+  // Given random byte string ( seed ) of length `seedBytes` and vector v ∈ Rq^(l×1) ( in
+  // evaluation domain ), this routine computes A * v ∈ Rq^(l×1) ( or A^T * v, if
+  // transposed = true ), s.t. A ∈ Rq^(l×l) is the matrix generated by `gen_matrix` from
+  // same seed, without ever materializing A ( or copying it into transposed layout ).
+  // SHAKE128 output is squeezed one polynomial at a time, which is unpacked, evaluated and
+  // multiply-accumulated into its output row right away, so that working set is a single
+  // polynomial and a single row accumulator, instead of whole matrix. When transposed,
+  // each polynomial of a row of A contributes to a different output row, so all l
+  // accumulators are kept live, instead.
+  //
+  // When intra-operation parallelism is enabled ( see `parallel` ), whole SHAKE128 output
+  // is squeezed upfront, instead, so that each output row, reading its own polynomials
+  // out of it, can be computed by a different thread.
+  template<size_t seedBytes, bool transposed = false, typename D>
+  inline static poly_matrix_t<rows, 1, moduli> gen_matrix_vec_mul(std::span<const uint8_t, seedBytes> seed, const poly_matrix_eval_t<cols, 1, D>& vec)
+    requires((rows == cols) && (moduli <= D::MAX_MODULI))
+  {
+    constexpr size_t ϵ = saber_params::log2(moduli);
+    constexpr size_t poly_blen = (poly::N * ϵ) / 8;
+
+    poly_matrix_t<rows, 1, moduli> res;
+
+    shake128::shake128_t hasher;
+    hasher.absorb(seed);
+    hasher.finalize();
+
+#if defined SABER_PARALLEL
+    std::array<uint8_t, rows * cols * poly_blen> bufs;
+    hasher.squeeze(bufs);
+    hasher.reset();
+
+    parallel::for_each(rows, [&](const size_t i) {
+      alignas(poly::ALIGNMENT) typename D::prod_t acc{};
+
+      for (size_t j = 0; j < cols; j++) {
+        // i-th row of A^T is i-th column of A
+        const size_t idx = transposed ? (j * cols + i) : (i * cols + j);
+        const auto bstr = std::span(bufs).subspan(idx * poly_blen, poly_blen);
+        const poly::poly_t<moduli> poly(bstr);
+
+        D::mul_acc(acc, D::template evaluate<moduli>(poly.as_array()), vec[j]);
+      }
+      res[i] = D::interpolate(acc);
+    });
+#else
+    std::array<uint8_t, poly_blen> buf;
+
+    if constexpr (transposed) {
+      alignas(poly::ALIGNMENT) std::array<typename D::prod_t, cols> acc{};
+
+      for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+          hasher.squeeze(buf);
+          const poly::poly_t<moduli> poly(buf);
+          D::mul_acc(acc[j], D::template evaluate<moduli>(poly.as_array()), vec[i]);
+        }
+      }
+
+      for (size_t j = 0; j < cols; j++) {
+        res[j] = D::interpolate(acc[j]);
+      }
+    } else {
+      for (size_t i = 0; i < rows; i++) {
+        alignas(poly::ALIGNMENT) typename D::prod_t acc{};
+
+        for (size_t j = 0; j < cols; j++) {
+          hasher.squeeze(buf);
+          const poly::poly_t<moduli> poly(buf);
+          D::mul_acc(acc, D::template evaluate<moduli>(poly.as_array()), vec[j]);
+        }
+        res[i] = D::interpolate(acc);
+      }
+    }
+
+    hasher.reset();
+#endif
+
+    return res;
+  }
+
+  // Batched variant of `gen_matrix_vec_mul`, computing A_i * v_i ( or A_i^T * v_i, if
+  // transposed = true ) for all i ∈ [0, lanes), s.t. A_i is the matrix generated from i-th
+  // seed ( all seeds must be of same length ). SHAKE128 instances are driven in lockstep,
+  // using multi-buffer Keccak, while one polynomial of each matrix is squeezed at a time
+  // and multiply-accumulated into its own output row, same as the scalar variant does.
+  template<bool transposed = false, size_t lanes = keccak_batch::LANES, typename D>
+  inline static std::array<poly_matrix_t<rows, 1, moduli>, lanes> gen_matrix_vec_mul_batch(std::array<std::span<const uint8_t>, lanes> seeds,
+                                                                                          const std::array<poly_matrix_eval_t<cols, 1, D>, lanes>& vecs)
+    requires((rows == cols) && (moduli <= D::MAX_MODULI))
+  {
+    constexpr size_t ϵ = saber_params::log2(moduli);
+    constexpr size_t poly_blen = (poly::N * ϵ) / 8;
+    constexpr size_t accs = transposed ? cols : 1;
+
+    std::array<poly_matrix_t<rows, 1, moduli>, lanes> res;
+
+    std::array<std::array<uint8_t, poly_blen>, lanes> bufs;
+    std::array<std::span<uint8_t>, lanes> outs;
+
+    for (size_t k = 0; k < lanes; k++) {
+      outs[k] = bufs[k];
+    }
+
+    alignas(poly::ALIGNMENT) std::array<std::array<typename D::prod_t, accs>, lanes> acc{};
+
+    keccak_batch::shake128_t<lanes> hasher;
+    hasher.absorb(seeds);
+    hasher.finalize();
+
+    for (size_t i = 0; i < rows; i++) {
+      for (size_t j = 0; j < cols; j++) {
+        hasher.squeeze(outs);
+
+        for (size_t k = 0; k < lanes; k++) {
+          const poly::poly_t<moduli> poly(bufs[k]);
+
+          if constexpr (transposed) {
+            D::mul_acc(acc[k][j], D::template evaluate<moduli>(poly.as_array()), vecs[k][i]);
+          } else {
+            D::mul_acc(acc[k][0], D::template evaluate<moduli>(poly.as_array()), vecs[k][j]);
+          }
+        }
+      }
+
+      if constexpr (!transposed) {
+        for (size_t k = 0; k < lanes; k++) {
+          res[k][i] = D::interpolate(acc[k][0]);
+          acc[k][0] = {};
+        }
+      }
+    }
+
+    if constexpr (transposed) {
+      for (size_t k = 0; k < lanes; k++) {
+        for (size_t j = 0; j < cols; j++) {
+          res[k][j] = D::interpolate(acc[k][j]);
+        }
+      }
+    }
+
+    hasher.reset();
+    return res;
+  }
+
   // Given a random byte string ( seed ) of length `seedBytes` as input, this routine
   // outputs a secret vector v ∈ Rq^(l×1) with its coefficients sampled from either a
   // centered binomial distribution β_μ ( if uniform_sampling = false ) or a centered
@@ -193,7 +570,7 @@ public:
 
     poly_matrix_t<rows, 1, moduli> vec;
 
-    std::array<uint8_t, buf_blen> buf{};
+    std::array<uint8_t, buf_blen> buf;
     auto _buf = std::span<uint8_t, buf_blen>(buf);
 
     shake128::shake128_t hasher;
@@ -208,22 +585,88 @@ public:
       const size_t off = i * poly_blen;
       auto __buf = poly_t_(_buf.subspan(off, poly_blen));
 
-      if constexpr (uniform_sampling) {
-        vec[i] = saber_utils::uniform_sample<moduli>(__buf);
-      } else {
-        vec[i] = saber_utils::cbd<moduli, mu>(__buf);
-      }
+      vec[i] = saber_utils::sample_secret<moduli, mu, uniform_sampling>(__buf);
     }
 
     return vec;
   }
 
+  // Batched variant of `gen_matrix`, generating `lanes` -many matrices, i-th one from i-th
+  // seed ( all seeds must be of same length ), whose SHAKE128 instances are driven in
+  // lockstep, using multi-buffer Keccak. Output is squeezed one polynomial ( of each
+  // instance ) at a time, so that buffer size doesn't grow with matrix dimension.
+  template<size_t lanes = keccak_batch::LANES>
+  inline static std::array<poly_matrix_t<rows, cols, moduli>, lanes> gen_matrix_batch(std::array<std::span<const uint8_t>, lanes> seeds)
+    requires(rows == cols)
+  {
+    constexpr size_t ϵ = saber_params::log2(moduli);
+    constexpr size_t poly_blen = (poly::N * ϵ) / 8;
+
+    std::array<poly_matrix_t<rows, cols, moduli>, lanes> mats;
+
+    std::array<std::array<uint8_t, poly_blen>, lanes> bufs;
+    std::array<std::span<uint8_t>, lanes> outs;
+
+    for (size_t k = 0; k < lanes; k++) {
+      outs[k] = bufs[k];
+    }
+
+    keccak_batch::shake128_t<lanes> hasher;
+    hasher.absorb(seeds);
+    hasher.finalize();
+
+    for (size_t i = 0; i < rows * cols; i++) {
+      hasher.squeeze(outs);
+
+      for (size_t k = 0; k < lanes; k++) {
+        mats[k].elements[i] = poly::poly_t<moduli>(bufs[k]);
+      }
+    }
+
+    hasher.reset();
+    return mats;
+  }
+
+  // Batched variant of `gen_secret`, sampling `lanes` -many secret vectors, i-th one from
+  // i-th seed ( all seeds must be of same length ), whose SHAKE128 instances are driven in
+  // lockstep, using multi-buffer Keccak.
+  template<bool uniform_sampling, size_t mu, size_t lanes = keccak_batch::LANES>
+  inline static std::array<poly_matrix_t<rows, 1, moduli>, lanes> gen_secret_batch(std::array<std::span<const uint8_t>, lanes> seeds)
+    requires((cols == 1) && saber_params::validate_gen_secret_args(uniform_sampling, mu))
+  {
+    constexpr size_t poly_blen = (poly::N * mu) / 8;
+
+    std::array<poly_matrix_t<rows, 1, moduli>, lanes> vecs;
+
+    std::array<std::array<uint8_t, poly_blen>, lanes> bufs;
+    std::array<std::span<uint8_t>, lanes> outs;
+
+    for (size_t k = 0; k < lanes; k++) {
+      outs[k] = bufs[k];
+    }
+
+    keccak_batch::shake128_t<lanes> hasher;
+    hasher.absorb(seeds);
+    hasher.finalize();
+
+    for (size_t i = 0; i < rows; i++) {
+      hasher.squeeze(outs);
+
+      for (size_t k = 0; k < lanes; k++) {
+        vecs[k][i] = saber_utils::sample_secret<moduli, mu, uniform_sampling>(bufs[k]);
+      }
+    }
+
+    hasher.reset();
+    return vecs;
+  }
+
   // Given a matrix M of dimension m x n, this routine is used for computing its
   // transpose M' s.t. resulting matrix's dimension becomes n x m. Note, m == n.
   inline constexpr poly_matrix_t<cols, rows, moduli> transpose() const
     requires(rows == cols)
   {
-    poly_matrix_t<cols, rows, moduli> res{};
+    poly_matrix_t<cols, rows, moduli> res;
 
     for (size_t i = 0; i < cols; i++) {
       for (size_t j = 0; j < rows; j++) {
@@ -235,4 +678,153 @@ public:
   }
 };
 
+// Wrapper type holding a matrix/ vector of polynomials, each of them already transformed
+// into evaluation domain of polynomial multiplier `D` ( see `polymul::domain_t` ), so
+// that a fixed operand ( say matrix A or vector b of a long-lived key ) is evaluated only
+// once, while only fresh operands are evaluated for each multiplication. Note, moduli of
+// the result is chosen only when interpolating it.
+template<size_t rows, size_t cols, typename D>
+struct poly_matrix_eval_t
+{
+private:
+  alignas(poly::ALIGNMENT) zq::uninit_t<std::array<typename D::eval_t, rows * cols>> elements;
+
+public:
+  // Constructors, default one leaves elements uninitialized, so that an array of them (
+  // see `gen_matrix_vec_mul_batch` ) can be filled in later.
+  inline poly_matrix_eval_t() = default;
+
+  // Evaluates each element polynomial of given matrix/ vector.
+  template<uint16_t moduli>
+  inline explicit poly_matrix_eval_t(const poly_matrix_t<rows, cols, moduli>& mat)
+  {
+    for (size_t i = 0; i < rows * cols; i++) {
+      D::template evaluate<moduli>(mat[i].as_array(), elements.v[i]);
+    }
+  }
+
+  // Given linearized matrix index, returns const reference to requested element
+  // polynomial, in evaluation domain. `idx` must ∈ [0, rows * cols).
+  inline constexpr const typename D::eval_t& operator[](const size_t idx) const { return this->elements.v[idx]; }
+
+  // Given row and column index of matrix, returns const reference to requested element
+  // polynomial, in evaluation domain.
+  inline constexpr const typename D::eval_t& operator[](std::pair<size_t, size_t> idx) const { return this->elements.v[idx.first * cols + idx.second]; }
+
+  // Given a matrix M ∈ Rq^(l×l) and vector v ∈ Rq^(l×1), both in evaluation domain, this
+  // routine performs a matrix vector multiplication, returning a vector mv ∈ Rq^(l×1),
+  // following algorithm 13 of spec, interpolating only once per output polynomial.
+  template<uint16_t moduli, size_t rhs_rows>
+  inline poly_matrix_t<rows, 1, moduli> mat_vec_mul(const poly_matrix_eval_t<rhs_rows, 1, D>& vec) const
+    requires((rows == cols) && (cols == rhs_rows) && (moduli <= D::MAX_MODULI))
+  {
+    poly_matrix_t<rows, 1, moduli> res;
+
+    // rows are independent, see `parallel::for_each`
+    parallel::for_each(rows, [&](const size_t i) {
+      alignas(poly::ALIGNMENT) typename D::prod_t acc{};
+
+      for (size_t j = 0; j < cols; j++) {
+        D::mul_acc(acc, (*this)[{ i, j }], vec[j]);
+      }
+      res[i] = D::interpolate(acc);
+    });
+
+    return res;
+  }
+
+  // Given two vectors v_a, v_b ∈ Rp^(l×1), both in evaluation domain, this routine
+  // computes their inner product, returning a polynomial c ∈ Rp, following algorithm 14
+  // of spec, interpolating only once.
+  template<uint16_t moduli>
+  inline poly::poly_t<moduli> inner_prod(const poly_matrix_eval_t<rows, cols, D>& vec) const
+    requires((cols == 1) && (moduli <= D::MAX_MODULI))
+  {
+    alignas(poly::ALIGNMENT) typename D::prod_t acc{};
+
+    for (size_t i = 0; i < rows; i++) {
+      D::mul_acc(acc, this->elements.v[i], vec.elements.v[i]);
+    }
+
+    return D::interpolate(acc);
+  }
+};
+
+// Matrix of polynomials in coefficient-major layout i.e. i-th coefficient of all
+// rows * cols element polynomials are contiguous ( see `polymul_batch::batch_t` ), in a
+// cache line aligned buffer. Walking over matrix, one coefficient at a time, becomes a
+// linear stream of aligned SIMD loads, which is how matrix vector multiplication is
+// performed, multiplying all element polynomials in a single batch, one per lane.
+template<size_t rows, size_t cols, uint16_t moduli>
+struct poly_matrix_cm_t
+{
+private:
+  static constexpr size_t lanes = rows * cols;
+
+  alignas(poly::ALIGNMENT) polymul_batch::batch_t<poly::N, lanes> coeffs;
+
+public:
+  // Given a matrix of polynomials, transposes it into coefficient-major layout.
+  inline explicit poly_matrix_cm_t(const poly_matrix_t<rows, cols, moduli>& mat)
+  {
+    for (size_t k = 0; k < poly::N; k++) {
+      for (size_t l = 0; l < lanes; l++) {
+        coeffs[k][l] = mat[l][k];
+      }
+    }
+  }
+
+  // Given linearized matrix index and coefficient index, returns coefficient of requested
+  // element polynomial. `idx` must ∈ [0, rows * cols) and `coeff` must ∈ [0, N).
+  inline constexpr zq::zq_t operator()(const size_t idx, const size_t coeff) const { return coeffs[coeff][idx]; }
+
+  // Transposes matrix back into polynomial-major layout.
+  inline poly_matrix_t<rows, cols, moduli> to_matrix() const
+  {
+    poly_matrix_t<rows, cols, moduli> res;
+
+    for (size_t k = 0; k < poly::N; k++) {
+      for (size_t l = 0; l < lanes; l++) {
+        res[l][k] = coeffs[k][l];
+      }
+    }
+
+    return res;
+  }
+
+  // Given a matrix M ∈ Rq^(l×l) and vector v ∈ Rq^(l×1), this routine performs a matrix
+  // vector multiplication, returning a vector mv ∈ Rq^(l×1), following algorithm 13 of
+  // spec. Vector is broadcast s.t. j-th element polynomial sits in every lane of j-th
+  // column, so that all l * l products are computed by one batched Karatsuba
+  // multiplication, before lanes of each row are summed up.
+  template<size_t rhs_rows>
+  inline poly_matrix_t<rows, 1, moduli> mat_vec_mul(const poly_matrix_t<rhs_rows, 1, moduli>& vec) const
+    requires((rows == cols) && (cols == rhs_rows))
+  {
+    alignas(poly::ALIGNMENT) polymul_batch::batch_t<poly::N, lanes> vecs;
+    for (size_t k = 0; k < poly::N; k++) {
+      for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+          vecs[k][i * cols + j] = vec[j][k];
+        }
+      }
+    }
+
+    alignas(poly::ALIGNMENT) const auto prods = polymul_batch::karamul<poly::N, lanes>(coeffs, vecs);
+
+    poly_matrix_t<rows, 1, moduli> res;
+    for (size_t k = 0; k < poly::N; k++) {
+      for (size_t i = 0; i < rows; i++) {
+        zq::zq_t acc{};
+        for (size_t j = 0; j < cols; j++) {
+          acc += prods[k][i * cols + j];
+        }
+        res[i][k] = acc;
+      }
+    }
+
+    return res;
+  }
+};
+
 }
@@ -0,0 +1,200 @@
+#pragma once
+#include "karatsuba.hpp"
+#include "kronecker.hpp"
+#include "ntt.hpp"
+#include "params.hpp"
+#include "schoolbook.hpp"
+#include "toom_cook.hpp"
+#include "zq.hpp"
+#include <array>
+#include <span>
+
+// Evaluation domain of the compile-time selected polynomial multiplication backend, s.t.
+// sums of products can be accumulated point-wise and interpolated back only once. Each
+// backend exposes same interface
+//
+// - `eval_t` : Evaluated form of a polynomial
+// - `prod_t` : (Sum of) point-wise product(s) of two evaluated polynomials
+// - `evaluate(poly) -> eval_t`, or `evaluate(poly, eval)` writing into uninitialized `eval`
+// - `mul_acc(acc, eval_a, eval_b)` i.e. acc += eval_a * eval_b
+// - `interpolate(acc) -> poly` i.e. reduced modulo (x ** N + 1)
+namespace polymul {
+
+// For all parameter sets of Saber KEM, degree of polynomials over Zq is 255.
+constexpr size_t N = 256;
+
+#if defined SABER_POLYMUL_NTT
+
+// Multiplication in NTT domain is exact over Z_(2^16).
+constexpr uint16_t MAX_MODULI = 1u << 15;
+
+using eval_t = ntt::ntt_poly_t;
+using prod_t = ntt::ntt_poly_t;
+
+// Computes NTT representation of polynomial.
+static inline constexpr eval_t
+evaluate(const std::array<zq::zq_t, N>& poly)
+{
+  return ntt::to_ntt(poly);
+}
+
+// Computes NTT representation of polynomial, writing it to `res`.
+static inline constexpr void
+evaluate(const std::array<zq::zq_t, N>& poly, eval_t& res)
+{
+  res = ntt::to_ntt(poly);
+}
+
+// Multiplies two polynomials in NTT domain, accumulating result into `acc`.
+static inline constexpr void
+mul_acc(prod_t& acc, const eval_t& polya, const eval_t& polyb)
+{
+  acc += polya * polyb;
+}
+
+// Brings accumulated products back to coefficient form.
+static inline constexpr std::array<zq::zq_t, N>
+interpolate(const prod_t& acc)
+{
+  return ntt::from_ntt(acc);
+}
+
+#else
+
+#if defined SABER_POLYMUL_KARATSUBA
+
+// Karatsuba multiplication is exact over Z_(2^16).
+constexpr uint16_t MAX_MODULI = 1u << 15;
+
+// Polynomial is evaluated by unrolling Karatsuba recursion, till the cut-off.
+constexpr size_t LIMBS = 1;
+constexpr size_t LIMB_LEN = N;
+constexpr size_t LEAF_CUTOFF = karatsuba::CUTOFF;
+
+#elif defined SABER_POLYMUL_KRONECKER
+
+// See `kronecker::MAX_MODULI`.
+constexpr uint16_t MAX_MODULI = kronecker::MAX_MODULI;
+
+// Polynomial is evaluated by unrolling Karatsuba recursion, till the cut-off, below
+// which pieces are multiplied using Kronecker substitution.
+constexpr size_t LIMBS = 1;
+constexpr size_t LIMB_LEN = N;
+constexpr size_t LEAF_CUTOFF = kronecker::CUTOFF;
+
+#else
+
+// See `toom_cook::MAX_MODULI`.
+constexpr uint16_t MAX_MODULI = toom_cook::MAX_MODULI;
+
+// Polynomial is evaluated at seven points of Toom-Cook 4-way split, then each limb is
+// further evaluated by unrolling Karatsuba recursion, till the cut-off.
+constexpr size_t LIMBS = 7;
+constexpr size_t LIMB_LEN = N / 4;
+constexpr size_t LEAF_CUTOFF = karatsuba::CUTOFF;
+
+#endif
+
+constexpr size_t PIECE_LEN = karatsuba::piece_len<LIMB_LEN, LEAF_CUTOFF>();
+constexpr size_t PIECES_PER_LIMB = karatsuba::eval_count<LIMB_LEN, LEAF_CUTOFF>();
+constexpr size_t PIECES = LIMBS * PIECES_PER_LIMB;
+
+using eval_t = std::array<std::array<zq::zq_t, PIECE_LEN>, PIECES>;
+using prod_t = std::array<std::array<zq::zq_t, 2 * PIECE_LEN>, PIECES>;
+
+// Splits polynomial into pieces, which are to be multiplied using schoolbook algorithm,
+// writing them to `res`.
+static inline constexpr void
+evaluate(const std::array<zq::zq_t, N>& poly, eval_t& res)
+{
+  auto ress = std::span<std::array<zq::zq_t, PIECE_LEN>, PIECES>(res);
+
+#if defined SABER_POLYMUL_KARATSUBA || defined SABER_POLYMUL_KRONECKER
+  karatsuba::evaluate<LIMB_LEN, LEAF_CUTOFF>(poly, ress);
+#else
+  const auto limbs = toom_cook::evaluate(poly);
+  for (size_t i = 0; i < LIMBS; i++) {
+    karatsuba::evaluate<LIMB_LEN, LEAF_CUTOFF>(limbs[i], ress.subspan(i * PIECES_PER_LIMB).first<PIECES_PER_LIMB>());
+  }
+#endif
+}
+
+// Splits polynomial into pieces, which are to be multiplied using schoolbook algorithm.
+static inline constexpr eval_t
+evaluate(const std::array<zq::zq_t, N>& poly)
+{
+  eval_t res;
+  evaluate(poly, res);
+  return res;
+}
+
+// Multiplies evaluated polynomials piece-wise, using schoolbook algorithm ( or Kronecker
+// substitution ), accumulating results into `acc`.
+static inline constexpr void
+mul_acc(prod_t& acc, const eval_t& polya, const eval_t& polyb)
+{
+  for (size_t i = 0; i < PIECES; i++) {
+#if defined SABER_POLYMUL_KRONECKER
+    kronecker::mul_acc<PIECE_LEN>(polya[i], polyb[i], acc[i]);
+#else
+    schoolbook::mul_acc<PIECE_LEN>(polya[i], polyb[i], acc[i]);
+#endif
+  }
+}
+
+// Interpolates accumulated piece-wise products back to a polynomial and reduces it
+// modulo (x ** N + 1).
+static inline constexpr std::array<zq::zq_t, N>
+interpolate(const prod_t& acc)
+{
+  auto accs = std::span<const std::array<zq::zq_t, 2 * PIECE_LEN>, PIECES>(acc);
+
+#if defined SABER_POLYMUL_KARATSUBA || defined SABER_POLYMUL_KRONECKER
+  const auto polyab = karatsuba::interpolate<LIMB_LEN, LEAF_CUTOFF>(accs);
+
+  std::array<zq::zq_t, N> res;
+  for (size_t i = 0; i < N; i++) {
+    res[i] = polyab[i] - polyab[N + i];
+  }
+
+  return res;
+#else
+  zq::uninit_t<std::array<std::array<zq::zq_t, 2 * LIMB_LEN>, LIMBS>> prods;
+  for (size_t i = 0; i < LIMBS; i++) {
+    prods.v[i] = karatsuba::interpolate<LIMB_LEN, LEAF_CUTOFF>(accs.subspan(i * PIECES_PER_LIMB).first<PIECES_PER_LIMB>());
+  }
+
+  return toom_cook::interpolate<N>(prods.v);
+#endif
+}
+
+#endif
+
+// Selected backend, wrapped as a type ( see `smallmul::domain_t` for the other one ), so
+// that matrix/ vector types can keep their elements in its evaluation domain. Evaluation
+// doesn't depend on moduli of polynomial.
+struct domain_t
+{
+  using eval_t = polymul::eval_t;
+  using prod_t = polymul::prod_t;
+
+  static constexpr uint16_t MAX_MODULI = polymul::MAX_MODULI;
+
+  template<uint16_t moduli>
+  static inline constexpr void evaluate(const std::array<zq::zq_t, N>& poly, eval_t& res)
+  {
+    polymul::evaluate(poly, res);
+  }
+
+  template<uint16_t moduli>
+  static inline constexpr eval_t evaluate(const std::array<zq::zq_t, N>& poly)
+  {
+    return polymul::evaluate(poly);
+  }
+
+  static inline constexpr void mul_acc(prod_t& acc, const eval_t& polya, const eval_t& polyb) { polymul::mul_acc(acc, polya, polyb); }
+
+  static inline constexpr std::array<zq::zq_t, N> interpolate(const prod_t& acc) { return polymul::interpolate(acc); }
+};
+
+}
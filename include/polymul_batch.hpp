@@ -0,0 +1,173 @@
+#pragma once
+#include "karatsuba.hpp"
+#include "params.hpp"
+#include "polynomial.hpp"
+#include "zq.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+
+// Batched Multiplication of independent pairs of Polynomials, one pair per SIMD lane.
+// Per product, it runs about as fast as multiplying in evaluation domain of `polymul`, so
+// it's used only for matrices kept in coefficient-major layout ( see
+// `mat::poly_matrix_cm_t` ), not by batched KEM routines, see `matvec/group/*` benchmarks.
+namespace polymul_batch {
+
+// Default number of independent multiplications performed at once s.t. each lane holds
+// a 16 -bit coefficient of a 256 -bit register. Any other lane count ( say 32, for
+// targets with 512 -bit registers ) can be requested explicitly, though 16 lanes keep the
+// working set of each Karatsuba leaf small enough to stay in registers and have been
+// found to be faster, even on AVX-512 capable CPUs.
+constexpr size_t LANES = 16;
+
+// I-th coefficient of `lanes` -many independent polynomials.
+template<size_t lanes>
+using lane_t = std::array<zq::zq_t, lanes>;
+
+// `lanes` -many independent polynomials of degree N-1, in coefficient-major layout i.e.
+// all lanes of i-th coefficient are contiguous, so that each arithmetic operation over a
+// coefficient maps to element-wise SIMD operation, without any horizontal shuffle.
+template<size_t N, size_t lanes>
+using batch_t = std::array<lane_t<lanes>, N>;
+
+// Given `lanes` -many polynomials, this routine transposes them into coefficient-major
+// layout, so that they can be multiplied in a batch.
+template<uint16_t moduli, size_t lanes>
+static inline constexpr batch_t<poly::N, lanes>
+pack(std::span<const poly::poly_t<moduli>, lanes> polys)
+{
+  batch_t<poly::N, lanes> res;
+
+  for (size_t i = 0; i < poly::N; i++) {
+    for (size_t l = 0; l < lanes; l++) {
+      res[i][l] = polys[l][i];
+    }
+  }
+
+  return res;
+}
+
+// Given a batch of polynomials in coefficient-major layout, this routine transposes them
+// back to `lanes` -many polynomials.
+template<uint16_t moduli, size_t lanes>
+static inline constexpr void
+unpack(const batch_t<poly::N, lanes>& batch, std::span<poly::poly_t<moduli>, lanes> polys)
+{
+  for (size_t i = 0; i < poly::N; i++) {
+    for (size_t l = 0; l < lanes; l++) {
+      polys[l][i] = batch[i][l];
+    }
+  }
+}
+
+// Given two batches of polynomials of degree N-1 ( s.t. N >= 1 ), this routine
+// multiplies them lane-wise using schoolbook algorithm, writing resulting polynomials of
+// degree 2*N - 1 to `polyab`. Each resulting coefficient is accumulated in registers,
+// before being written back to memory only once.
+template<size_t N, size_t lanes>
+static inline constexpr void
+schoolbook(std::span<const lane_t<lanes>, N> polya, std::span<const lane_t<lanes>, N> polyb, std::span<lane_t<lanes>, 2 * N> polyab)
+{
+  for (size_t k = 0; k < 2 * N - 1; k++) {
+    const size_t beg = (k + 1 > N) ? (k + 1 - N) : 0;
+    const size_t end = std::min(k + 1, N);
+
+    lane_t<lanes> acc{};
+    for (size_t i = beg; i < end; i++) {
+      for (size_t l = 0; l < lanes; l++) {
+        acc[l] += polya[i][l] * polyb[k - i][l];
+      }
+    }
+
+    polyab[k] = acc;
+  }
+
+  polyab[2 * N - 1] = lane_t<lanes>{};
+}
+
+// Given two batches of polynomials of degree N-1 ( s.t. N is power of 2 and N >= 1 ),
+// this routine multiplies them lane-wise using Karatsuba algorithm, writing resulting
+// polynomials of degree 2*N - 1 to `polyab`, following `karatsuba::karatsuba`, along
+// with same scratch space requirement, now counted in lanes.
+template<size_t N, size_t lanes, size_t cutoff = karatsuba::CUTOFF>
+static inline constexpr void
+karatsuba(std::span<const lane_t<lanes>, N> polya,
+          std::span<const lane_t<lanes>, N> polyb,
+          std::span<lane_t<lanes>, 2 * N> polyab,
+          std::span<lane_t<lanes>, karatsuba::scratch_len<N, cutoff>()> scratch)
+  requires(saber_params::is_power_of_2(N) && saber_params::is_power_of_2(cutoff) && (cutoff > 0))
+{
+  if constexpr (N <= cutoff) {
+    schoolbook<N, lanes>(polya, polyb, polyab);
+  } else {
+    constexpr size_t Nby2 = N / 2;
+
+    auto polyax = scratch.template subspan<0, Nby2>();
+    auto polybx = scratch.template subspan<Nby2, Nby2>();
+    auto polyaxbx = scratch.template subspan<N, N>();
+    auto rest = scratch.template subspan<2 * N>();
+
+    for (size_t i = 0; i < Nby2; i++) {
+      for (size_t l = 0; l < lanes; l++) {
+        polyax[i][l] = polya[i][l] + polya[Nby2 + i][l];
+        polybx[i][l] = polyb[i][l] + polyb[Nby2 + i][l];
+      }
+    }
+
+    karatsuba<Nby2, lanes, cutoff>(polya.template first<Nby2>(), polyb.template first<Nby2>(), polyab.template first<N>(), rest);
+    karatsuba<Nby2, lanes, cutoff>(polya.template last<Nby2>(), polyb.template last<Nby2>(), polyab.template last<N>(), rest);
+    karatsuba<Nby2, lanes, cutoff>(polyax, polybx, polyaxbx, rest);
+
+    for (size_t i = 0; i < N; i++) {
+      for (size_t l = 0; l < lanes; l++) {
+        polyaxbx[i][l] = polyaxbx[i][l] - zq::zq_t(polyab[i][l] + polyab[N + i][l]);
+      }
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      for (size_t l = 0; l < lanes; l++) {
+        polyab[Nby2 + i][l] = polyab[Nby2 + i][l] + polyaxbx[i][l];
+      }
+    }
+  }
+}
+
+// Given two batches of polynomials of degree N-1 ( s.t. N is power of 2 and N >= 1 ),
+// this routine multiplies them lane-wise using Karatsuba algorithm and reduces resulting
+// polynomials modulo (x ** N + 1), following `karatsuba::karamul`.
+template<size_t N, size_t lanes>
+static inline constexpr batch_t<N, lanes>
+karamul(const batch_t<N, lanes>& polya, const batch_t<N, lanes>& polyb)
+{
+  zq::uninit_t<batch_t<2 * N, lanes>> polyab;
+  zq::uninit_t<batch_t<karatsuba::scratch_len<N>(), lanes>> scratch;
+
+  karatsuba<N, lanes>(polya, polyb, polyab.v, scratch.v);
+
+  batch_t<N, lanes> res;
+  for (size_t i = 0; i < N; i++) {
+    for (size_t l = 0; l < lanes; l++) {
+      res[i][l] = polyab.v[i][l] - polyab.v[N + i][l];
+    }
+  }
+
+  return res;
+}
+
+// Given `lanes` -many pairs of polynomials, this routine multiplies each pair in Rq,
+// by packing them in coefficient-major layout, multiplying them in a batch and unpacking
+// the products.
+template<uint16_t moduli, size_t lanes = LANES>
+static inline void
+polymul(std::span<const poly::poly_t<moduli>, lanes> polya,
+        std::span<const poly::poly_t<moduli>, lanes> polyb,
+        std::span<poly::poly_t<moduli>, lanes> polyab)
+{
+  const auto batcha = pack<moduli, lanes>(polya);
+  const auto batchb = pack<moduli, lanes>(polyb);
+  const auto batchab = karamul<poly::N, lanes>(batcha, batchb);
+
+  unpack<moduli, lanes>(batchab, polyab);
+}
+
+}
@@ -1,9 +1,17 @@
 #pragma once
+#include "bitpack.hpp"
+#include "dispatch.hpp"
 #include "karatsuba.hpp"
+#include "kronecker.hpp"
+#include "ntt.hpp"
 #include "params.hpp"
+#include "toom_cook.hpp"
 #include "utils.hpp"
 #include "zq.hpp"
 #include <array>
+#include <concepts>
+#include <type_traits>
+#include <utility>
 
 // Operations defined over quotient ring Rq
 namespace poly {
@@ -11,31 +19,275 @@ namespace poly {
 // For all parameter sets of Saber KEM, degree of polynomials over Zq is 255.
 constexpr size_t N = 256;
 
+// Coefficients of a polynomial ( and other SIMD-friendly buffers ) are aligned to cache
+// line boundary, so that no vector load of them straddles two cache lines.
+constexpr size_t ALIGNMENT = 64;
+
+template<uint16_t moduli>
+  requires(saber_params::is_power_of_2(moduli))
+struct poly_t;
+
+// Polynomial over Zq or a lazily evaluated, coefficient-wise expression over
+// polynomials, which can be indexed to compute only requested coefficient.
+template<typename T>
+concept poly_like = requires(const std::remove_cvref_t<T>& t, const size_t idx) {
+  { std::remove_cvref_t<T>::MODULI } -> std::convertible_to<uint16_t>;
+  { t[idx] } -> std::convertible_to<zq::zq_t>;
+};
+
+template<typename T>
+struct is_poly : std::false_type
+{};
+
+template<uint16_t moduli>
+struct is_poly<poly_t<moduli>> : std::true_type
+{};
+
+// Lazily evaluated expression over polynomials, which is not itself a polynomial.
+template<typename T>
+concept poly_expr = poly_like<T> && !is_poly<std::remove_cvref_t<T>>::value;
+
+// How an operand is held by a lazy expression. Polynomials bound to a name are held by
+// reference, while temporaries ( including sub-expressions, which are cheap to copy ) are
+// held by value, so that an expression never outlives its operands.
+template<typename T>
+using operand_t = std::conditional_t<std::is_lvalue_reference_v<T> && is_poly<std::remove_cvref_t<T>>::value,
+                                     const std::remove_cvref_t<T>&,
+                                     std::remove_cvref_t<T>>;
+
+// Coefficient-wise operations, which can be applied to a pair of coefficients or to a
+// pair of polynomials ( or matrices of them ), lazily.
+struct add_op_t
+{
+  static inline constexpr zq::zq_t apply(const zq::zq_t a, const zq::zq_t b) { return a + b; }
+  template<typename L, typename R>
+  inline constexpr auto operator()(L&& a, R&& b) const
+  {
+    return std::forward<L>(a) + std::forward<R>(b);
+  }
+};
+
+struct sub_op_t
+{
+  static inline constexpr zq::zq_t apply(const zq::zq_t a, const zq::zq_t b) { return a - b; }
+  template<typename L, typename R>
+  inline constexpr auto operator()(L&& a, R&& b) const
+  {
+    return std::forward<L>(a) - std::forward<R>(b);
+  }
+};
+
+struct shl_op_t
+{
+  static inline constexpr zq::zq_t apply(const zq::zq_t a, const size_t off) { return a << off; }
+  template<typename T>
+  inline constexpr auto operator()(T&& a, const size_t off) const
+  {
+    return std::forward<T>(a) << off;
+  }
+};
+
+struct shr_op_t
+{
+  static inline constexpr zq::zq_t apply(const zq::zq_t a, const size_t off) { return a >> off; }
+  template<typename T>
+  inline constexpr auto operator()(T&& a, const size_t off) const
+  {
+    return std::forward<T>(a) >> off;
+  }
+};
+
+// Common interface of lazy expressions over polynomials, whose coefficients are over Zq,
+// s.t. q = moduli. Coefficients are computed in a single pass, only when an expression
+// is assigned to a polynomial or serialized.
+template<typename E, uint16_t moduli>
+struct poly_expr_t
+{
+  static constexpr uint16_t MODULI = moduli;
+
+  // Change moduli of expression to a different value, lazily.
+  template<uint16_t new_moduli>
+  inline constexpr auto mod() const
+    requires(moduli != new_moduli);
+
+  // Evaluates expression, materializing a polynomial.
+  inline constexpr poly_t<moduli> eval() const { return poly_t<moduli>(static_cast<const E&>(*this)); }
+
+  // Evaluates expression and serializes resulting polynomial, see `poly_t::to_bytes`.
+  inline void to_bytes(std::span<uint8_t> bstr) const { eval().to_bytes(bstr); }
+
+  // Same as above, using portable implementation of polynomial serialization.
+  inline void to_bytes_generic(std::span<uint8_t> bstr) const { eval().to_bytes_generic(bstr); }
+};
+
+// Lazy coefficient-wise addition/ subtraction of two polynomials.
+template<typename Op, typename Lhs, typename Rhs>
+struct binary_expr_t : poly_expr_t<binary_expr_t<Op, Lhs, Rhs>, std::remove_cvref_t<Lhs>::MODULI>
+{
+  Lhs lhs;
+  Rhs rhs;
+
+  template<typename L, typename R>
+  inline constexpr binary_expr_t(L&& l, R&& r)
+    : lhs(std::forward<L>(l))
+    , rhs(std::forward<R>(r))
+  {
+  }
+
+  inline constexpr zq::zq_t operator[](const size_t idx) const { return Op::apply(lhs[idx], rhs[idx]); }
+};
+
+// Lazy left/ right shift of each coefficient of a polynomial.
+template<typename Op, typename Arg>
+struct shift_expr_t : poly_expr_t<shift_expr_t<Op, Arg>, std::remove_cvref_t<Arg>::MODULI>
+{
+  Arg arg;
+  size_t off;
+
+  template<typename T>
+  inline constexpr shift_expr_t(T&& a, const size_t o)
+    : arg(std::forward<T>(a))
+    , off(o)
+  {
+  }
+
+  inline constexpr zq::zq_t operator[](const size_t idx) const { return Op::apply(arg[idx], off); }
+};
+
+// Lazy change of moduli of a polynomial, which leaves coefficients as they are.
+template<uint16_t new_moduli, typename Arg>
+struct mod_expr_t : poly_expr_t<mod_expr_t<new_moduli, Arg>, new_moduli>
+{
+  Arg arg;
+
+  template<typename T>
+  inline constexpr explicit mod_expr_t(T&& a)
+    : arg(std::forward<T>(a))
+  {
+  }
+
+  inline constexpr zq::zq_t operator[](const size_t idx) const { return arg[idx]; }
+};
+
+template<typename E, uint16_t moduli>
+template<uint16_t new_moduli>
+inline constexpr auto
+poly_expr_t<E, moduli>::mod() const
+  requires(moduli != new_moduli)
+{
+  return mod_expr_t<new_moduli, E>(static_cast<const E&>(*this));
+}
+
+// Addition of two polynomials s.t. their coefficients are over Zq, lazily.
+template<typename L, typename R>
+  requires(poly_like<L> && poly_like<R> && (std::remove_cvref_t<L>::MODULI == std::remove_cvref_t<R>::MODULI))
+inline constexpr auto
+operator+(L&& lhs, R&& rhs)
+{
+  return binary_expr_t<add_op_t, operand_t<L>, operand_t<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+}
+
+// Subtraction of one polynomial from another one s.t. their coefficients are over Zq,
+// lazily.
+template<typename L, typename R>
+  requires(poly_like<L> && poly_like<R> && (std::remove_cvref_t<L>::MODULI == std::remove_cvref_t<R>::MODULI))
+inline constexpr auto
+operator-(L&& lhs, R&& rhs)
+{
+  return binary_expr_t<sub_op_t, operand_t<L>, operand_t<R>>(std::forward<L>(lhs), std::forward<R>(rhs));
+}
+
+// Left shift each coefficient of the polynomial by factor `off`, lazily.
+template<typename T>
+  requires(poly_like<T>)
+inline constexpr auto
+operator<<(T&& arg, const size_t off)
+{
+  return shift_expr_t<shl_op_t, operand_t<T>>(std::forward<T>(arg), off);
+}
+
+// Right shift each coefficient of the polynomial by factor `off`, lazily.
+template<typename T>
+  requires(poly_like<T>)
+inline constexpr auto
+operator>>(T&& arg, const size_t off)
+{
+  return shift_expr_t<shr_op_t, operand_t<T>>(std::forward<T>(arg), off);
+}
+
 // Wrapper type encapsulating operations over Rq = Zq[X]/(X^N + 1), N = 256
 template<uint16_t moduli>
   requires(saber_params::is_power_of_2(moduli))
 struct poly_t
 {
 private:
-  std::array<zq::zq_t, N> coeffs{};
+  alignas(ALIGNMENT) std::array<zq::zq_t, N> coeffs;
 
 public:
+  static constexpr uint16_t MODULI = moduli;
+
   // Constructors
   inline constexpr poly_t() = default;
-  inline constexpr poly_t(std::array<zq::zq_t, N>& arr) { coeffs = arr; }
-  inline constexpr poly_t(std::array<zq::zq_t, N>&& arr) { coeffs = arr; }
-  inline constexpr poly_t(const std::array<zq::zq_t, N>& arr) { coeffs = arr; }
-  inline constexpr poly_t(const std::array<zq::zq_t, N>&& arr) { coeffs = arr; }
+  inline constexpr poly_t(const std::array<zq::zq_t, N>& arr)
+    : coeffs(arr)
+  {
+  }
+
+  // Evaluates a lazy expression over polynomials, in a single pass over coefficients.
+  template<typename E>
+    requires(poly_expr<E> && (E::MODULI == moduli))
+  inline constexpr poly_t(const E& expr)
+  {
+    for (size_t i = 0; i < N; i++) {
+      coeffs[i] = expr[i];
+    }
+  }
+
+  // Evaluates a lazy expression over polynomials, overwriting coefficients of this
+  // polynomial, in a single pass. As operations are coefficient-wise, expression may
+  // refer to this polynomial itself.
+  template<typename E>
+    requires(poly_expr<E> && (E::MODULI == moduli))
+  inline constexpr poly_t& operator=(const E& expr)
+  {
+    for (size_t i = 0; i < N; i++) {
+      coeffs[i] = expr[i];
+    }
+    return *this;
+  }
 
   // Given a byte array of length log2(moduli) * 32 -bytes, this routine can be
-  // used for transforming it into a polynomial, following algorithm 9 of spec.
+  // used for transforming it into a polynomial, following algorithm 9 of spec, using
+  // variant best suited for the CPU, selected at runtime.
   inline explicit poly_t(std::span<const uint8_t> bstr)
     requires(saber_params::validate_poly_serialization_args<moduli>())
   {
+#if defined SABER_DISPATCH
+    constexpr size_t lg2_moduli = saber_params::log2(moduli);
+
+    if (dispatch::has_bmi2()) {
+      bitpack::unpack_bmi2<lg2_moduli>(bstr, coeffs);
+      return;
+    }
+    if (dispatch::has_avx2()) {
+      bitpack::unpack_avx2<lg2_moduli>(bstr, coeffs);
+      return;
+    }
+#endif
+
+    from_bytes_generic(bstr);
+  }
+
+  // Portable implementation of polynomial deserialization, see above, overwriting
+  // coefficients of this polynomial.
+  inline void from_bytes_generic(std::span<const uint8_t> bstr)
+    requires(saber_params::validate_poly_serialization_args<moduli>())
+  {
     constexpr size_t lg2_moduli = saber_params::log2(moduli);
     constexpr size_t blen = (lg2_moduli * N) / 8;
 
-    std::array<zq::zq_t, N> res{};
+    // Coefficients are decoded in place, without an intermediate buffer.
+    auto& res = coeffs;
 
     if constexpr (lg2_moduli == 13) {
       constexpr uint64_t mask13 = (1ul << lg2_moduli) - 1;
@@ -213,8 +465,6 @@ public:
         coff += 8;
       }
     }
-
-    coeffs = res;
   }
 
   // Returns reference to coefficient at given polynomial index ∈ [0, N).
@@ -223,71 +473,127 @@ public:
   // Returns const reference to coefficient at given polynomial index ∈ [0, N).
   inline constexpr const zq::zq_t& operator[](const size_t idx) const { return coeffs[idx]; }
 
-  // Addition of two polynomials s.t. their coefficients are over Zq.
-  inline constexpr poly_t operator+(const poly_t& rhs) const
-  {
-    std::array<zq::zq_t, N> res{};
+  // Returns const reference to underlying array of coefficients.
+  inline constexpr const std::array<zq::zq_t, N>& as_array() const { return coeffs; }
 
+  // In-place, coefficient-wise addition of a polynomial ( or a lazy expression over
+  // polynomials ) to this polynomial s.t. their coefficients are over Zq. No temporary
+  // polynomial is materialized.
+  template<typename E>
+    requires(poly_like<E> && (std::remove_cvref_t<E>::MODULI == moduli))
+  inline constexpr poly_t& operator+=(const E& rhs)
+  {
     for (size_t i = 0; i < N; i++) {
-      res[i] = coeffs[i] + rhs.coeffs[i];
+      coeffs[i] = add_op_t::apply(coeffs[i], rhs[i]);
     }
-
-    return res;
+    return *this;
   }
 
-  // Compound addition of two polynomials s.t. their coefficients are over Zq.
-  inline constexpr void operator+=(const poly_t& rhs) { *this = *this + rhs; }
-
-  // Subtraction of one polynomial from another one s.t. their coefficients are over Zq.
-  inline constexpr poly_t operator-(const poly_t& rhs) const
+  // In-place, coefficient-wise subtraction of a polynomial ( or a lazy expression over
+  // polynomials ) from this polynomial s.t. their coefficients are over Zq.
+  template<typename E>
+    requires(poly_like<E> && (std::remove_cvref_t<E>::MODULI == moduli))
+  inline constexpr poly_t& operator-=(const E& rhs)
   {
-    std::array<zq::zq_t, N> res{};
-
     for (size_t i = 0; i < N; i++) {
-      res[i] = coeffs[i] - rhs.coeffs[i];
+      coeffs[i] = sub_op_t::apply(coeffs[i], rhs[i]);
     }
-
-    return res;
+    return *this;
   }
 
-  // Multiplication of two polynomials s.t. their coefficients are over Zq.
-  inline constexpr poly_t operator*(const poly_t& rhs) const { return karatsuba::karamul(this->coeffs, rhs.coeffs); }
-
-  // Left shift each coefficient of the polynomial by factor `off`.
-  inline constexpr poly_t operator<<(const size_t off) const
+  // In-place left shift of each coefficient of this polynomial by factor `off`.
+  inline constexpr poly_t& operator<<=(const size_t off)
   {
-    std::array<zq::zq_t, N> res{};
-
     for (size_t i = 0; i < N; i++) {
-      res[i] = coeffs[i] << off;
+      coeffs[i] = shl_op_t::apply(coeffs[i], off);
     }
-
-    return res;
+    return *this;
   }
 
-  // Right shift each coefficient of the polynomial by factor `off`.
-  inline constexpr poly_t operator>>(const size_t off) const
+  // In-place right shift of each coefficient of this polynomial by factor `off`.
+  inline constexpr poly_t& operator>>=(const size_t off)
   {
-    std::array<zq::zq_t, N> res{};
-
     for (size_t i = 0; i < N; i++) {
-      res[i] = coeffs[i] >> off;
+      coeffs[i] = shr_op_t::apply(coeffs[i], off);
     }
+    return *this;
+  }
 
-    return res;
+  // Multiplication of two polynomials s.t. their coefficients are over Zq. By default
+  // Toom-Cook 4-way multiplication ( with Karatsuba for limb products ) is used, define
+  // `SABER_POLYMUL_KARATSUBA` for falling back to plain Karatsuba multiplication or
+  // `SABER_POLYMUL_NTT` for multiplying in NTT domain, over NTT-friendly primes.
+  inline constexpr poly_t operator*(const poly_t& rhs) const
+  {
+#if defined SABER_POLYMUL_NTT
+    return ntt::polymul(this->coeffs, rhs.coeffs);
+#elif defined SABER_POLYMUL_KARATSUBA
+    return karatsuba::karamul(this->coeffs, rhs.coeffs);
+#elif defined SABER_POLYMUL_KRONECKER
+    if constexpr (moduli <= kronecker::MAX_MODULI) {
+      return kronecker::kronmul(this->coeffs, rhs.coeffs);
+    } else {
+      return karatsuba::karamul(this->coeffs, rhs.coeffs);
+    }
+#else
+    if constexpr (moduli <= toom_cook::MAX_MODULI) {
+      return toom_cook::toom4mul(this->coeffs, rhs.coeffs);
+    } else {
+      return karatsuba::karamul(this->coeffs, rhs.coeffs);
+    }
+#endif
   }
 
-  // Change moduli of polynomial coefficients to different value.
+  // Change moduli of polynomial coefficients to different value, lazily. Result refers
+  // to this polynomial, so it must be evaluated before this polynomial goes out of scope.
   template<uint16_t new_moduli>
-  inline constexpr poly_t<new_moduli> mod() const
+  inline constexpr auto mod() const&
     requires(moduli != new_moduli)
   {
-    return std::move(coeffs);
+    return mod_expr_t<new_moduli, const poly_t&>(*this);
+  }
+
+  // Change moduli of a temporary polynomial to different value, lazily, taking over its
+  // coefficients.
+  template<uint16_t new_moduli>
+  inline constexpr auto mod() &&
+    requires(moduli != new_moduli)
+  {
+    return mod_expr_t<new_moduli, poly_t>(std::move(*this));
   }
 
   // Given a polynomial, this routine can transform it into a byte string of
-  // length log2(moduli) * 32, following algorithm 10 of spec.
-  inline void to_bytes(std::span<uint8_t> bstr)
+  // length log2(moduli) * 32, following algorithm 10 of spec, using variant best suited
+  // for the CPU, selected at runtime.
+  inline void to_bytes(std::span<uint8_t> bstr) const
+    requires(saber_params::validate_poly_serialization_args<moduli>())
+  {
+#if defined SABER_DISPATCH
+    constexpr size_t lg2_moduli = saber_params::log2(moduli);
+
+    // For wider coefficients, AVX2 packs sixteen of them using fewer instructions, than
+    // what BMI2 requires for eight of them.
+    if constexpr (lg2_moduli >= 8) {
+      if (dispatch::has_avx2()) {
+        bitpack::pack_avx2<lg2_moduli>(coeffs, bstr);
+        return;
+      }
+    }
+    if (dispatch::has_bmi2()) {
+      bitpack::pack_bmi2<lg2_moduli>(coeffs, bstr);
+      return;
+    }
+    if (dispatch::has_avx2()) {
+      bitpack::pack_avx2<lg2_moduli>(coeffs, bstr);
+      return;
+    }
+#endif
+
+    to_bytes_generic(bstr);
+  }
+
+  // Portable implementation of polynomial serialization, see `to_bytes`.
+  inline void to_bytes_generic(std::span<uint8_t> bstr) const
     requires(saber_params::validate_poly_serialization_args<moduli>())
   {
     constexpr size_t lg2_moduli = saber_params::log2(moduli);
@@ -451,6 +757,47 @@ public:
       }
     }
   }
+
+  // Given a rounding constant `rc`, this routine computes ((c_i + rc) >> off) mod
+  // new_moduli, for each coefficient c_i of this polynomial, and serializes result into a
+  // byte string of length log2(new_moduli) * 32, in a single pass. Same as
+  // `((*this + h) >> off).mod<new_moduli>().to_bytes(bstr)`, s.t. each coefficient of h
+  // is `rc`, but without materializing intermediate polynomials.
+  template<uint16_t new_moduli, size_t off>
+  inline void round_to_bytes(const uint16_t rc, std::span<uint8_t> bstr) const
+    requires(saber_params::validate_poly_serialization_args<new_moduli>())
+  {
+    constexpr size_t lg2_moduli = saber_params::log2(new_moduli);
+
+#if defined SABER_DISPATCH
+    if (dispatch::has_avx2()) {
+      bitpack::round_pack_avx2<lg2_moduli, off, false, 0>(coeffs, coeffs, rc, bstr);
+      return;
+    }
+#endif
+
+    bitpack::round_pack<lg2_moduli, off, false, 0>(coeffs, coeffs, rc, bstr);
+  }
+
+  // Same as above, but also subtracts polynomial `s`, left shifted by `sub_off`, i.e. it
+  // serializes ((c_i - (s_i << sub_off) + rc) >> off) mod new_moduli, for each
+  // coefficient, in a single pass. `s` can be a `poly_t` or one of its compact forms (
+  // see `poly8_t`, `poly1_t` ), which are read without widening them first.
+  template<uint16_t new_moduli, size_t off, size_t sub_off, typename S>
+  inline void sub_round_to_bytes(const S& s, const uint16_t rc, std::span<uint8_t> bstr) const
+    requires(saber_params::validate_poly_serialization_args<new_moduli>())
+  {
+    constexpr size_t lg2_moduli = saber_params::log2(new_moduli);
+
+#if defined SABER_DISPATCH
+    if (dispatch::has_avx2()) {
+      bitpack::round_pack_avx2<lg2_moduli, off, true, sub_off>(coeffs, s.as_array(), rc, bstr);
+      return;
+    }
+#endif
+
+    bitpack::round_pack<lg2_moduli, off, true, sub_off>(coeffs, s.as_array(), rc, bstr);
+  }
 };
 
 }
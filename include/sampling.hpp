@@ -1,4 +1,6 @@
 #pragma once
+#include "bitpack.hpp"
+#include "dispatch.hpp"
 #include "polynomial.hpp"
 #include "utils.hpp"
 
@@ -16,7 +18,7 @@ namespace saber_utils {
 // https://github.com/KULeuven-COSIC/SABER/blob/f7f39e4db2f3e22a21e1dd635e0601caae2b4510/Variants/uSaber-90s/ref/poly.c#L52-L82.
 template<uint16_t moduli>
 inline poly::poly_t<moduli>
-uniform_sample(std::span<const uint8_t, (poly::N * 2) / 8> bytes)
+uniform_sample_generic(std::span<const uint8_t, (poly::N * 2) / 8> bytes)
 {
   poly::poly_t<moduli> res;
 
@@ -47,7 +49,7 @@ uniform_sample(std::span<const uint8_t, (poly::N * 2) / 8> bytes)
 // https://github.com/itzmeanjan/kyber/blob/8cbb09472dc5f7e5ae8bc52cbcbf6344f637d4fe/include/sampling.hpp#L88-L152.
 template<uint16_t moduli, size_t mu>
 inline poly::poly_t<moduli>
-cbd(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
+cbd_generic(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
   requires((mu == 10) || (mu == 8) || (mu == 6))
 {
   constexpr size_t muby2 = mu / 2;
@@ -115,4 +117,171 @@ cbd(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
   return res;
 }
 
+#if defined SABER_DISPATCH
+
+// Number of bytes read by `sample16_avx2`, while sampling sixteen coefficients.
+static inline constexpr size_t
+sample16_reads(const size_t mu)
+{
+  return mu == 8 ? 16 : (3 * mu) / 2 + 16;
+}
+
+// Given 2 * mu bytes, this routine samples sixteen coefficients, held in 16 -bit lanes of
+// a register, from either Centered Uniform Distribution ( if uniform_sampling = true, so
+// that mu = 2 ) or Centered Binomial Distribution, using AVX2. Each mu -bit field of byte
+// string is first unpacked into a 16 -bit lane. For uniform sampling, 2 -bit field is
+// centered, same as `uniform_sample_generic`. For binomial sampling, Hamming weights of
+// lower and upper mu/2 bits of a field are computed side by side, by adding mu/2 shifted
+// copies of it, masked to lowest bit of both halves ( same as `cbd_generic` does, over
+// 32/ 64 -bit words ), so that sampled coefficient is their difference, sign-extended to
+// 16 -bit. Byte aligned fields ( i.e. mu = 8 ) are simply zero-extended. Reads ( at max )
+// `sample16_reads(mu)` bytes from `src`.
+template<size_t mu, bool uniform_sampling>
+SABER_TARGET_AVX2 static inline __m256i
+sample16_avx2(const uint8_t* const src)
+{
+  __m256i x;
+  if constexpr (mu == 8) {
+    x = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+  } else {
+    x = bitpack::unpack16_avx2<mu>(src);
+  }
+
+  if constexpr (uniform_sampling) {
+    const auto two = _mm256_set1_epi16(2);
+    return _mm256_sub_epi16(_mm256_xor_si256(x, two), two);
+  } else {
+    constexpr size_t muby2 = mu / 2;
+
+    const auto mask = _mm256_set1_epi16((1 << muby2) | 1);
+    const auto mask_lo = _mm256_set1_epi16((1 << muby2) - 1);
+
+    auto hw = _mm256_and_si256(x, mask);
+    for (size_t i = 1; i < muby2; i++) {
+      hw = _mm256_add_epi16(hw, _mm256_and_si256(_mm256_srli_epi16(x, static_cast<int>(i)), mask));
+    }
+
+    return _mm256_sub_epi16(_mm256_and_si256(hw, mask_lo), _mm256_srli_epi16(hw, muby2));
+  }
+}
+
+// Given a byte string of length mu * 32, this routine samples a degree-255 polynomial,
+// sixteen coefficients at a time, see `sample16_avx2`. Last few blocks, for which
+// vectorized loads would read past end of byte string, are first copied to a zero-padded
+// buffer.
+template<uint16_t moduli, size_t mu, bool uniform_sampling>
+SABER_TARGET_AVX2 static inline poly::poly_t<moduli>
+sample_avx2(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
+{
+  constexpr size_t blen = 2 * mu;
+  constexpr size_t reads = sample16_reads(mu);
+  constexpr size_t full_blocks = (bytes.size() - reads) / blen + 1;
+
+  poly::poly_t<moduli> res;
+
+  for (size_t i = 0; i < full_blocks; i++) {
+    const auto x = sample16_avx2<mu, uniform_sampling>(bytes.data() + i * blen);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&res[i * 16]), x);
+  }
+
+  for (size_t i = full_blocks; i < poly::N / 16; i++) {
+    std::array<uint8_t, reads> buf{};
+    std::memcpy(buf.data(), bytes.data() + i * blen, blen);
+
+    const auto x = sample16_avx2<mu, uniform_sampling>(buf.data());
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&res[i * 16]), x);
+  }
+
+  return res;
+}
+
+// Centered Uniform Distribution, vectorized using AVX2, see `sample_avx2`.
+template<uint16_t moduli>
+SABER_TARGET_AVX2 inline poly::poly_t<moduli>
+uniform_sample_avx2(std::span<const uint8_t, (poly::N * 2) / 8> bytes)
+{
+  return sample_avx2<moduli, 2, true>(bytes);
+}
+
+// Centered Uniform Distribution, compiled for AVX-512. Same AVX2 kernel is used, as
+// sampling is bound by unpacking of byte string, which is done sixteen fields at a time.
+template<uint16_t moduli>
+SABER_TARGET_AVX512 inline poly::poly_t<moduli>
+uniform_sample_avx512(std::span<const uint8_t, (poly::N * 2) / 8> bytes)
+{
+  return sample_avx2<moduli, 2, true>(bytes);
+}
+
+// Centered Binomial Distribution, vectorized using AVX2, see `sample_avx2`.
+template<uint16_t moduli, size_t mu>
+SABER_TARGET_AVX2 inline poly::poly_t<moduli>
+cbd_avx2(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
+  requires((mu == 10) || (mu == 8) || (mu == 6))
+{
+  return sample_avx2<moduli, mu, false>(bytes);
+}
+
+// Centered Binomial Distribution, compiled for AVX-512, using same AVX2 kernel, see
+// `uniform_sample_avx512`.
+template<uint16_t moduli, size_t mu>
+SABER_TARGET_AVX512 inline poly::poly_t<moduli>
+cbd_avx512(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
+  requires((mu == 10) || (mu == 8) || (mu == 6))
+{
+  return sample_avx2<moduli, mu, false>(bytes);
+}
+
+#endif
+
+// Samples a degree-255 polynomial from Centered Uniform Distribution, using variant
+// best suited for the CPU, selected at runtime.
+template<uint16_t moduli>
+inline poly::poly_t<moduli>
+uniform_sample(std::span<const uint8_t, (poly::N * 2) / 8> bytes)
+{
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx512()) {
+    return uniform_sample_avx512<moduli>(bytes);
+  }
+  if (dispatch::has_avx2()) {
+    return uniform_sample_avx2<moduli>(bytes);
+  }
+#endif
+
+  return uniform_sample_generic<moduli>(bytes);
+}
+
+// Samples a degree-255 polynomial from Centered Binomial Distribution, using variant
+// best suited for the CPU, selected at runtime.
+template<uint16_t moduli, size_t mu>
+inline poly::poly_t<moduli>
+cbd(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
+  requires((mu == 10) || (mu == 8) || (mu == 6))
+{
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx512()) {
+    return cbd_avx512<moduli, mu>(bytes);
+  }
+  if (dispatch::has_avx2()) {
+    return cbd_avx2<moduli, mu>(bytes);
+  }
+#endif
+
+  return cbd_generic<moduli, mu>(bytes);
+}
+
+// Samples a degree-255 polynomial, as an element of secret vector, from either Centered
+// Uniform Distribution ( if uniform_sampling = true ) or Centered Binomial Distribution
+// ( if uniform_sampling = false ), following algorithm 16 of Saber spec.
+template<uint16_t moduli, size_t mu, bool uniform_sampling>
+inline poly::poly_t<moduli>
+sample_secret(std::span<const uint8_t, (poly::N * mu) / 8> bytes)
+{
+  if constexpr (uniform_sampling) {
+    return uniform_sample<moduli>(bytes);
+  } else {
+    return cbd<moduli, mu>(bytes);
+  }
+}
+
 }
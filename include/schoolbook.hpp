@@ -0,0 +1,186 @@
+#pragma once
+#include "dispatch.hpp"
+#include "params.hpp"
+#include "zq.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+
+#if defined SABER_DISPATCH
+#include <immintrin.h>
+#endif
+
+// Schoolbook Multiplication of two Polynomials
+namespace schoolbook {
+
+// Given two polynomials of degree N-1 ( s.t. N >= 1 ), this routine multiplies them
+// using schoolbook algorithm, computing resulting polynomial of degree 2*N - 1, using
+// scalar arithmetic over Zq.
+template<size_t N>
+static inline constexpr std::array<zq::zq_t, 2 * N>
+mul_scalar(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& polyb)
+{
+  std::array<zq::zq_t, 2 * N> polyab{};
+
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) {
+      polyab[i + j] += polya[i] * polyb[j];
+    }
+  }
+
+  return polyab;
+}
+
+#if defined SABER_DISPATCH
+
+// Given two polynomials of degree N-1 ( s.t. N is a multiple of 16 ), this routine
+// multiplies them using schoolbook algorithm, adding resulting polynomial of degree
+// 2*N - 1 to `polyab`, using AVX2 16 -bit multiply-accumulate over sixteen Zq lanes.
+//
+// Result is processed in groups of ( at max ) eight blocks of sixteen coefficients,
+// each group being kept in registers, while coefficients of `polya` contributing to it
+// are broadcast one after another, multiplied with consecutive coefficients of
+// zero-padded `polyb`, so that no horizontal shuffle is required and no intermediate
+// product is ever written back to memory.
+//
+// It's a register-blocked, general purpose kernel: both operands are treated as full
+// 16 -bit elements of Zq, nothing is assumed about their magnitude. Callers ( see
+// `polymul::mul_acc` ) pass the public operand ( matrix A or vector b ) as `polya`, so
+// it's the public side which is broadcast, while the secret side is loaded in blocks.
+template<size_t N>
+SABER_TARGET_AVX2 static inline void
+mul_acc_avx2(std::span<const zq::zq_t, N> polya, std::span<const zq::zq_t, N> polyb, std::span<zq::zq_t, 2 * N> polyab)
+  requires(((N % 16) == 0) && ((N <= 64) || (N % 64) == 0))
+{
+  constexpr size_t LANES = 16;
+  constexpr size_t BLOCKS = (2 * N) / LANES;
+  constexpr size_t GROUP = std::min<size_t>(BLOCKS, 8);
+
+  // Zero-padded `polyb` s.t. padb[N + i] = polyb[i], for i ∈ [0, N)
+  std::array<zq::zq_t, 3 * N> padb{};
+  std::copy(polyb.begin(), polyb.end(), padb.begin() + N);
+
+  const auto padb_ptr = reinterpret_cast<const uint16_t*>(padb.data());
+  const auto polyab_ptr = reinterpret_cast<uint16_t*>(polyab.data());
+
+  for (size_t grp = 0; grp < BLOCKS; grp += GROUP) {
+    const size_t off = grp * LANES;
+
+    __m256i acc[GROUP];
+    for (size_t blk = 0; blk < GROUP; blk++) {
+      acc[blk] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(polyab_ptr + off + blk * LANES));
+    }
+
+    // Only those coefficients of `polya` contribute to this group, for which at
+    // least one lane overlaps with non-zero coefficients of `polyb`.
+    const size_t beg = (off + 1 > N) ? (off + 1 - N) : 0;
+    const size_t end = std::min(N, off + GROUP * LANES);
+
+    for (size_t i = beg; i < end; i++) {
+      const auto va = _mm256_set1_epi16(static_cast<short>(polya[i].as_raw()));
+
+      for (size_t blk = 0; blk < GROUP; blk++) {
+        const auto vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(padb_ptr + N + off + blk * LANES - i));
+        acc[blk] = _mm256_add_epi16(acc[blk], _mm256_mullo_epi16(va, vb));
+      }
+    }
+
+    for (size_t blk = 0; blk < GROUP; blk++) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(polyab_ptr + off + blk * LANES), acc[blk]);
+    }
+  }
+}
+
+// Given two polynomials of degree N-1 ( s.t. N is a multiple of 16 ), this routine
+// multiplies them using schoolbook algorithm, adding resulting polynomial of degree
+// 2*N - 1 to `polyab`, using AVX-512 16 -bit multiply-accumulate over thirty two Zq
+// lanes, following `mul_acc_avx2`.
+template<size_t N>
+SABER_TARGET_AVX512 static inline void
+mul_acc_avx512(std::span<const zq::zq_t, N> polya, std::span<const zq::zq_t, N> polyb, std::span<zq::zq_t, 2 * N> polyab)
+  requires(((N % 16) == 0) && ((N <= 128) || (N % 128) == 0))
+{
+  constexpr size_t LANES = 32;
+  constexpr size_t BLOCKS = (2 * N) / LANES;
+  constexpr size_t GROUP = std::min<size_t>(BLOCKS, 8);
+
+  // Zero-padded `polyb` s.t. padb[N + i] = polyb[i], for i ∈ [0, N)
+  std::array<zq::zq_t, 3 * N> padb{};
+  std::copy(polyb.begin(), polyb.end(), padb.begin() + N);
+
+  const auto padb_ptr = reinterpret_cast<const uint16_t*>(padb.data());
+  const auto polyab_ptr = reinterpret_cast<uint16_t*>(polyab.data());
+
+  for (size_t grp = 0; grp < BLOCKS; grp += GROUP) {
+    const size_t off = grp * LANES;
+
+    __m512i acc[GROUP];
+    for (size_t blk = 0; blk < GROUP; blk++) {
+      acc[blk] = _mm512_loadu_si512(polyab_ptr + off + blk * LANES);
+    }
+
+    const size_t beg = (off + 1 > N) ? (off + 1 - N) : 0;
+    const size_t end = std::min(N, off + GROUP * LANES);
+
+    for (size_t i = beg; i < end; i++) {
+      const auto va = _mm512_set1_epi16(static_cast<short>(polya[i].as_raw()));
+
+      for (size_t blk = 0; blk < GROUP; blk++) {
+        const auto vb = _mm512_loadu_si512(padb_ptr + N + off + blk * LANES - i);
+        acc[blk] = _mm512_add_epi16(acc[blk], _mm512_mullo_epi16(va, vb));
+      }
+    }
+
+    for (size_t blk = 0; blk < GROUP; blk++) {
+      _mm512_storeu_si512(polyab_ptr + off + blk * LANES, acc[blk]);
+    }
+  }
+}
+
+#endif
+
+// Given two polynomials of degree N-1 ( s.t. N >= 1 ), this routine multiplies them
+// using schoolbook algorithm, adding resulting polynomial of degree 2*N - 1 to `polyab`.
+// When CPU supports AVX-512 or AVX2 ( and N is a multiple of 16 ), it uses vectorized
+// kernel, selected at runtime, otherwise it falls back to portable scalar implementation.
+template<size_t N>
+static inline constexpr void
+mul_acc(std::span<const zq::zq_t, N> polya, std::span<const zq::zq_t, N> polyb, std::span<zq::zq_t, 2 * N> polyab)
+{
+#if defined SABER_DISPATCH
+  if (!std::is_constant_evaluated()) {
+    if constexpr (((N % 16) == 0) && ((N <= 128) || (N % 128) == 0)) {
+      if (dispatch::has_avx512()) {
+        mul_acc_avx512<N>(polya, polyb, polyab);
+        return;
+      }
+    }
+    if constexpr (((N % 16) == 0) && ((N <= 64) || (N % 64) == 0)) {
+      if (dispatch::has_avx2()) {
+        mul_acc_avx2<N>(polya, polyb, polyab);
+        return;
+      }
+    }
+  }
+#endif
+
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) {
+      polyab[i + j] += polya[i] * polyb[j];
+    }
+  }
+}
+
+// Given two polynomials of degree N-1 ( s.t. N >= 1 ), this routine multiplies them
+// using schoolbook algorithm, computing resulting polynomial of degree 2*N - 1.
+template<size_t N>
+static inline constexpr std::array<zq::zq_t, 2 * N>
+mul(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& polyb)
+{
+  std::array<zq::zq_t, 2 * N> polyab{};
+  mul_acc<N>(polya, polyb, polyab);
+  return polyab;
+}
+
+}
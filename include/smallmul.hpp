@@ -0,0 +1,658 @@
+#pragma once
+#include "dispatch.hpp"
+#include "ntt.hpp"
+#include "params.hpp"
+#include "zq.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#if defined SABER_DISPATCH
+#include <immintrin.h>
+#endif
+
+// Multiplication of a public Polynomial and a small Secret Polynomial, over 16 -bit
+// NTT-friendly primes
+namespace smallmul {
+
+// Each ring product computed by Saber PKE has one public operand ( i.e. matrix A, vector
+// b or b', over Zq s.t. q <= 2^13 ) and one secret operand ( i.e. vector s or s', sampled
+// from β_μ or U_μ ), whose coefficients are at most 5 in absolute value. Once both are
+// lifted to centered representatives, their negacyclic product has coefficients bounded
+// by 2^8 * 2^12 * 5 < 2^22.4, so that a sum of up to four of them ( i.e. an inner product,
+// for l <= 4 ) is bounded by 2^24.4. Hence it can be computed exactly modulo two 16 -bit
+// primes s.t. P0 * P1 > 2^26.3, reconstructed by CRT and reduced modulo 2^16. Compared
+// to `ntt`, which multiplies arbitrary polynomials over Zq, using two 32 -bit primes, all
+// modular arithmetic is done over signed 16 -bit lanes, sixteen of them in an AVX2
+// register.
+constexpr size_t N = 256;
+constexpr size_t LOG2N = saber_params::log2(N);
+
+constexpr int16_t P0 = 7681;  // = 15 * 2^9 + 1, with primitive root 17
+constexpr int16_t P1 = 10753; // = 21 * 2^9 + 1, with primitive root 11
+
+// Operands, which can be multiplied exactly i.e. public one's moduli must be <= 2^13 and
+// secret one's coefficients must be ∈ [-5, 5], while at most four such products can be
+// accumulated, before being brought back to coefficient form.
+constexpr uint16_t MAX_MODULI = 1u << 13;
+constexpr int32_t MAX_SECRET = 5;
+constexpr int32_t MAX_TERMS = 4;
+
+static_assert(MAX_TERMS * static_cast<int32_t>(N) * (MAX_MODULI / 2) * MAX_SECRET < (static_cast<int32_t>(P0) * P1) / 2,
+              "Accumulated products must be reconstructed exactly by CRT !");
+
+// Compile-time compute P^-1 mod 2^16, using Newton's iteration, required for signed
+// Montgomery multiplication.
+template<int16_t P>
+static inline constexpr int16_t
+qinv()
+  requires((P & 1) == 1)
+{
+  uint32_t x = static_cast<uint32_t>(P); // correct modulo 2^3
+  for (size_t i = 0; i < 3; i++) {
+    x *= 2u - static_cast<uint32_t>(P) * x;
+  }
+
+  return static_cast<int16_t>(static_cast<uint16_t>(x));
+}
+
+// Compile-time compute centered representative ∈ (-P/2, P/2] of a ∈ [0, P).
+template<int16_t P>
+static inline constexpr int16_t
+center(const uint32_t a)
+{
+  return static_cast<int16_t>(a > static_cast<uint32_t>(P / 2) ? static_cast<int32_t>(a) - P : static_cast<int32_t>(a));
+}
+
+// Montgomery radix R = 2^16, modulo prime P.
+template<int16_t P>
+constexpr uint32_t R_MOD = (1u << 16) % static_cast<uint32_t>(P);
+
+// Barrett reduction constant, round(2^26 / P).
+template<int16_t P>
+constexpr int16_t BARRETT = static_cast<int16_t>(((1u << 26) + static_cast<uint32_t>(P) / 2) / static_cast<uint32_t>(P));
+
+// Given a, b s.t. |a * b| < P * 2^15, this routine computes r ≡ a * b * R^-1 ( mod P ),
+// R = 2^16, s.t. |r| < P, using signed Montgomery multiplication, in constant-time.
+template<int16_t P>
+static inline constexpr int16_t
+mont_mul(const int16_t a, const int16_t b)
+{
+  const int32_t t = static_cast<int32_t>(a) * static_cast<int32_t>(b);
+  const auto m = static_cast<int16_t>(static_cast<uint16_t>(static_cast<uint32_t>(t) * static_cast<uint32_t>(qinv<P>())));
+
+  return static_cast<int16_t>((t - static_cast<int32_t>(m) * P) >> 16);
+}
+
+// Given a signed 16 -bit integer a, this routine computes r ≡ a ( mod P ) s.t. r is
+// ( almost ) centered i.e. |r| <= P/2 + 1, using Barrett reduction, in constant-time.
+template<int16_t P>
+static inline constexpr int16_t
+reduce(const int16_t a)
+{
+  const int32_t t0 = (static_cast<int32_t>(a) * BARRETT<P>) >> 16;
+  const int32_t t1 = (t0 + (1 << 9)) >> 10;
+
+  return static_cast<int16_t>(a - t1 * P);
+}
+
+// Compile-time compute powers of 2N -th primitive root of unity ψ, in bit-reversed
+// order, s.t. ψ = g ^ ((P - 1) / 2N). Each of them is kept in Montgomery form i.e.
+// multiplied by R = 2^16, as centered representative.
+template<int16_t P, uint32_t g>
+static inline constexpr std::array<int16_t, N>
+compute_zetas()
+  requires(((P - 1) % (2 * N)) == 0)
+{
+  constexpr uint32_t ψ = ntt::pow<P>(g, (P - 1) / (2 * N));
+  static_assert(ntt::pow<P>(ψ, N) == static_cast<uint32_t>(P - 1), "ψ must be 2N -th primitive root of unity !");
+
+  std::array<int16_t, N> res{};
+  for (size_t i = 0; i < N; i++) {
+    res[i] = center<P>(ntt::mul<P>(ntt::pow<P>(ψ, ntt::bit_rev<LOG2N>(i)), R_MOD<P>));
+  }
+
+  return res;
+}
+
+// Powers of ψ, modulo each prime, in bit-reversed order and Montgomery form.
+template<int16_t P>
+constexpr std::array<int16_t, N> ZETAS = compute_zetas<P, (P == P0) ? 17u : 11u>();
+
+// Given level `len` of a transform ( i.e. distance between coefficients, which are
+// combined by a butterfly ) and index `i` of a coefficient, this routine returns twiddle
+// factor used by the butterfly, combining coefficient i ( and i + len ), s.t. i mod 2len
+// < len, following forward and inverse NTT of `ntt`.
+template<int16_t P, bool inverse>
+static inline constexpr int16_t
+zeta(const size_t len, const size_t i)
+{
+  if constexpr (inverse) {
+    return static_cast<int16_t>(-ZETAS<P>[N / len - 1 - i / (2 * len)]);
+  } else {
+    return ZETAS<P>[N / (2 * len) + i / (2 * len)];
+  }
+}
+
+// Scaling factor applied at the end of inverse NTT, modulo each prime. Given that
+// Montgomery multiplication of two polynomials in NTT domain leaves a factor of R^-1,
+// it's compensated here, along with N^-1 i.e. scaling factor = N^-1 * R^2.
+template<int16_t P>
+constexpr int16_t INV_N = center<P>(ntt::mul<P>(ntt::inv<P>(N), ntt::mul<P>(R_MOD<P>, R_MOD<P>)));
+
+// Multiplicative inverse of P0, modulo P1, in Montgomery form, required for CRT
+// reconstruction.
+constexpr int16_t INV_P0_MOD_P1 = center<P1>(ntt::mul<P1>(ntt::inv<P1>(P0), R_MOD<P1>));
+
+// Vectorized transform works on a polynomial as a 16 x 16 matrix, whose row i holds
+// coefficients [16i, 16i + 16), one per lane. Levels with len >= 16 combine whole rows,
+// then matrix is transposed, so that levels with len < 16 also combine whole rows, with
+// each lane ( i.e. block of 16 coefficients ) using its own twiddle factor. Hence NTT
+// representation of a polynomial is kept transposed, which doesn't matter, as long as
+// it's only multiplied point-wise.
+constexpr size_t BLOCK = 16;
+
+// Given a polynomial as a 16 x 16 matrix ( see above ), this routine transposes it
+// in-place.
+static inline constexpr void
+transpose(std::array<int16_t, N>& poly)
+{
+  for (size_t i = 0; i < BLOCK; i++) {
+    for (size_t j = i + 1; j < BLOCK; j++) {
+      const int16_t t = poly[i * BLOCK + j];
+      poly[i * BLOCK + j] = poly[j * BLOCK + i];
+      poly[j * BLOCK + i] = t;
+    }
+  }
+}
+
+// Compile-time compute twiddle factors for levels with len < 16, of transposed polynomial
+// ( see above ), s.t. ( 8/len - 1 + g ) -th row holds twiddle factor of each block, used
+// while combining rows i and i + len, s.t. g = i / 2len. When `with_qinv` is set, each of
+// them is multiplied by P^-1 mod 2^16, as required by vectorized Montgomery
+// multiplication.
+template<int16_t P, bool inverse, bool with_qinv>
+static inline constexpr std::array<std::array<int16_t, BLOCK>, BLOCK - 1>
+compute_block_zetas()
+{
+  std::array<std::array<int16_t, BLOCK>, BLOCK - 1> res{};
+
+  for (size_t len = BLOCK / 2; len >= 1; len >>= 1) {
+    for (size_t g = 0; g < BLOCK / (2 * len); g++) {
+      for (size_t blk = 0; blk < BLOCK; blk++) {
+        const int16_t z = zeta<P, inverse>(len, blk * BLOCK + g * 2 * len);
+        const auto zq = static_cast<int16_t>(static_cast<uint16_t>(static_cast<uint32_t>(z) * static_cast<uint32_t>(qinv<P>())));
+
+        res[BLOCK / (2 * len) - 1 + g][blk] = with_qinv ? zq : z;
+      }
+    }
+  }
+
+  return res;
+}
+
+// Polynomial in NTT domain, represented by its residues modulo P0 and P1, each of them
+// kept in signed 16 -bit lanes and in transposed order ( see `BLOCK` ).
+struct eval_t
+{
+  alignas(32) std::array<int16_t, N> r0;
+  alignas(32) std::array<int16_t, N> r1;
+};
+
+// Sum of point-wise products of polynomials in NTT domain, which carries a factor of R^-1,
+// compensated during inverse NTT.
+using prod_t = eval_t;
+
+// Given a polynomial over Z_P, this routine applies in-place forward NTT, using
+// Cooley-Tukey butterfly, leaving its NTT representation in transposed order. Coefficients
+// are reduced after every two levels, so that none of them overflows 16 -bits.
+template<int16_t P>
+static inline constexpr void
+forward(std::array<int16_t, N>& poly)
+{
+  size_t level = 0;
+
+  for (size_t len = N / 2; len >= 1; len >>= 1) {
+    for (size_t i = 0; i < N; i++) {
+      if ((i & len) == 0) {
+        const int16_t t = mont_mul<P>(zeta<P, false>(len, i), poly[i + len]);
+
+        poly[i + len] = static_cast<int16_t>(poly[i] - t);
+        poly[i] = static_cast<int16_t>(poly[i] + t);
+      }
+    }
+
+    if ((++level & 1) == 0) {
+      for (size_t i = 0; i < N; i++) {
+        poly[i] = reduce<P>(poly[i]);
+      }
+    }
+  }
+
+  transpose(poly);
+}
+
+// Given a polynomial in NTT representation ( in transposed order ) over Z_P, this routine
+// applies in-place inverse NTT, using Gentleman-Sande butterfly, bringing it back to
+// coefficient form, s.t. |coefficient| < P.
+template<int16_t P>
+static inline constexpr void
+inverse(std::array<int16_t, N>& poly)
+{
+  transpose(poly);
+
+  size_t level = 0;
+
+  for (size_t len = 1; len < N; len <<= 1) {
+    for (size_t i = 0; i < N; i++) {
+      if ((i & len) == 0) {
+        const int16_t t = poly[i];
+
+        poly[i] = static_cast<int16_t>(t + poly[i + len]);
+        poly[i + len] = mont_mul<P>(zeta<P, true>(len, i), static_cast<int16_t>(t - poly[i + len]));
+      }
+    }
+
+    if ((++level & 1) == 0 && len < N / 2) {
+      for (size_t i = 0; i < N; i++) {
+        poly[i] = reduce<P>(poly[i]);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < N; i++) {
+    poly[i] = mont_mul<P>(poly[i], INV_N<P>);
+  }
+}
+
+// Given residues r0 ( mod P0 ) and r1 ( mod P1 ) of a coefficient c s.t. |c| < P0 * P1 / 2
+// ( see above ), this routine reconstructs c using CRT, returning c mod 2^16.
+static inline constexpr zq::zq_t
+crt(const int16_t r0, const int16_t r1)
+{
+  const int16_t t = reduce<P1>(mont_mul<P1>(static_cast<int16_t>(r1 - r0), INV_P0_MOD_P1));
+  return static_cast<uint16_t>(static_cast<uint32_t>(static_cast<uint16_t>(r0)) + static_cast<uint32_t>(static_cast<uint16_t>(t)) * P0);
+}
+
+#if defined SABER_DISPATCH
+
+// Given a, b and b * P^-1 mod 2^16, this routine computes a * b * R^-1 ( mod P ), using
+// signed Montgomery multiplication over sixteen 16 -bit lanes, see `mont_mul`.
+template<int16_t P>
+SABER_TARGET_AVX2 static inline __m256i
+mont_mul_avx2(const __m256i a, const __m256i b, const __m256i b_qinv)
+{
+  const auto lo = _mm256_mullo_epi16(a, b_qinv);
+  const auto hi = _mm256_mulhi_epi16(a, b);
+  const auto t = _mm256_mulhi_epi16(lo, _mm256_set1_epi16(P));
+
+  return _mm256_sub_epi16(hi, t);
+}
+
+// Barrett reduction over sixteen 16 -bit lanes, see `reduce`.
+template<int16_t P>
+SABER_TARGET_AVX2 static inline __m256i
+reduce_avx2(const __m256i a)
+{
+  const auto t0 = _mm256_mulhi_epi16(a, _mm256_set1_epi16(BARRETT<P>));
+  const auto t1 = _mm256_mulhrs_epi16(t0, _mm256_set1_epi16(1 << 5));
+
+  return _mm256_sub_epi16(a, _mm256_mullo_epi16(t1, _mm256_set1_epi16(P)));
+}
+
+// Given a polynomial as 16 x 16 matrix of 16 -bit lanes, one row per register, this
+// routine transposes it in-place, by interleaving 16, 32, 64 and 128 -bit elements of
+// row pairs.
+SABER_TARGET_AVX2 static inline void
+transpose_avx2(__m256i (&r)[BLOCK])
+{
+  __m256i a[BLOCK];
+  __m256i b[BLOCK];
+
+  // Rows 2i, 2i+1 interleaved, holding columns {0..3, 8..11} and {4..7, 12..15}
+  for (size_t i = 0; i < BLOCK; i += 2) {
+    a[i + 0] = _mm256_unpacklo_epi16(r[i], r[i + 1]);
+    a[i + 1] = _mm256_unpackhi_epi16(r[i], r[i + 1]);
+  }
+
+  // Rows 4i..4i+3, each 64 -bit element holding one column
+  for (size_t i = 0; i < BLOCK; i += 4) {
+    b[i + 0] = _mm256_unpacklo_epi32(a[i + 0], a[i + 2]);
+    b[i + 1] = _mm256_unpackhi_epi32(a[i + 0], a[i + 2]);
+    b[i + 2] = _mm256_unpacklo_epi32(a[i + 1], a[i + 3]);
+    b[i + 3] = _mm256_unpackhi_epi32(a[i + 1], a[i + 3]);
+  }
+
+  // Rows 8h..8h+7, k -th register holding column k in lower and k + 8 in upper half
+  for (size_t h = 0; h < BLOCK; h += 8) {
+    for (size_t m = 0; m < 4; m++) {
+      a[h + 2 * m + 0] = _mm256_unpacklo_epi64(b[h + m], b[h + 4 + m]);
+      a[h + 2 * m + 1] = _mm256_unpackhi_epi64(b[h + m], b[h + 4 + m]);
+    }
+  }
+
+  for (size_t k = 0; k < BLOCK / 2; k++) {
+    r[k] = _mm256_permute2x128_si256(a[k], a[8 + k], 0x20);
+    r[k + 8] = _mm256_permute2x128_si256(a[k], a[8 + k], 0x31);
+  }
+}
+
+// Reduces all sixteen rows of a polynomial, see `reduce`.
+template<int16_t P>
+SABER_TARGET_AVX2 static inline void
+reduce_all_avx2(__m256i (&r)[BLOCK])
+{
+  for (size_t i = 0; i < BLOCK; i++) {
+    r[i] = reduce_avx2<P>(r[i]);
+  }
+}
+
+// Applies one level of forward ( Cooley-Tukey ) or inverse ( Gentleman-Sande ) NTT on a
+// polynomial, as 16 x 16 matrix held in registers, combining coefficients at distance
+// `len`, using AVX2. For len >= 16, butterflies combine rows at distance len/16, sharing
+// a twiddle factor, which is broadcast. Otherwise matrix must already be transposed, so
+// that butterflies combine rows at distance len, while each lane ( i.e. block of 16
+// coefficients ) uses its own twiddle factor.
+template<int16_t P, bool inverse, size_t len>
+SABER_TARGET_AVX2 static inline void
+level_avx2(__m256i (&r)[BLOCK])
+{
+  static constexpr auto zetas = compute_block_zetas<P, inverse, false>();
+  static constexpr auto zetas_qinv = compute_block_zetas<P, inverse, true>();
+
+  constexpr size_t dist = (len >= BLOCK) ? (len / BLOCK) : len;
+
+  for (size_t j = 0; j < BLOCK / 2; j++) {
+    const size_t i = (j / dist) * 2 * dist + (j % dist);
+
+    __m256i z, zq;
+    if constexpr (len >= BLOCK) {
+      const int16_t zeta_ = zeta<P, inverse>(len, i * BLOCK);
+      const auto zeta_qinv = static_cast<int16_t>(static_cast<uint16_t>(static_cast<uint32_t>(zeta_) * static_cast<uint32_t>(qinv<P>())));
+
+      z = _mm256_set1_epi16(zeta_);
+      zq = _mm256_set1_epi16(zeta_qinv);
+    } else {
+      const size_t k = BLOCK / (2 * len) - 1 + i / (2 * len);
+
+      z = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(zetas[k].data()));
+      zq = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(zetas_qinv[k].data()));
+    }
+
+    if constexpr (inverse) {
+      const auto t = r[i];
+      r[i] = _mm256_add_epi16(t, r[i + dist]);
+      r[i + dist] = mont_mul_avx2<P>(_mm256_sub_epi16(t, r[i + dist]), z, zq);
+    } else {
+      const auto t = mont_mul_avx2<P>(r[i + dist], z, zq);
+      r[i + dist] = _mm256_sub_epi16(r[i], t);
+      r[i] = _mm256_add_epi16(r[i], t);
+    }
+  }
+}
+
+// Given a polynomial over Z_P, as 16 x 16 matrix held in registers, this routine applies
+// forward NTT, same as `forward`, using AVX2.
+template<int16_t P>
+SABER_TARGET_AVX2 static inline void
+forward_avx2(__m256i (&r)[BLOCK])
+{
+  level_avx2<P, false, 128>(r);
+  level_avx2<P, false, 64>(r);
+  reduce_all_avx2<P>(r);
+  level_avx2<P, false, 32>(r);
+  level_avx2<P, false, 16>(r);
+  reduce_all_avx2<P>(r);
+
+  transpose_avx2(r);
+
+  level_avx2<P, false, 8>(r);
+  level_avx2<P, false, 4>(r);
+  reduce_all_avx2<P>(r);
+  level_avx2<P, false, 2>(r);
+  level_avx2<P, false, 1>(r);
+  reduce_all_avx2<P>(r);
+}
+
+// Given a polynomial in NTT representation over Z_P, as 16 x 16 matrix held in registers,
+// this routine applies inverse NTT, same as `inverse`, using AVX2.
+template<int16_t P>
+SABER_TARGET_AVX2 static inline void
+inverse_avx2(__m256i (&r)[BLOCK])
+{
+  level_avx2<P, true, 1>(r);
+  level_avx2<P, true, 2>(r);
+  reduce_all_avx2<P>(r);
+  level_avx2<P, true, 4>(r);
+  level_avx2<P, true, 8>(r);
+  reduce_all_avx2<P>(r);
+
+  transpose_avx2(r);
+
+  level_avx2<P, true, 16>(r);
+  level_avx2<P, true, 32>(r);
+  reduce_all_avx2<P>(r);
+  level_avx2<P, true, 64>(r);
+  level_avx2<P, true, 128>(r);
+
+  constexpr auto inv_n_qinv = static_cast<int16_t>(static_cast<uint16_t>(static_cast<uint32_t>(INV_N<P>) * static_cast<uint32_t>(qinv<P>())));
+  for (size_t i = 0; i < BLOCK; i++) {
+    r[i] = mont_mul_avx2<P>(r[i], _mm256_set1_epi16(INV_N<P>), _mm256_set1_epi16(inv_n_qinv));
+  }
+}
+
+// Given a polynomial over Zq ( q = moduli ), this routine lifts its coefficients to
+// centered representatives and computes their NTT representation modulo both primes,
+// using AVX2.
+template<uint16_t moduli>
+SABER_TARGET_AVX2 static inline void
+evaluate_avx2(const std::array<zq::zq_t, N>& poly, eval_t& res)
+{
+  constexpr int shift = 16 - static_cast<int>(saber_params::log2(moduli));
+
+  const auto poly_ptr = reinterpret_cast<const __m256i*>(poly.data());
+  const auto r0_ptr = reinterpret_cast<__m256i*>(res.r0.data());
+  const auto r1_ptr = reinterpret_cast<__m256i*>(res.r1.data());
+
+  __m256i r[BLOCK];
+
+  for (size_t i = 0; i < BLOCK; i++) {
+    r[i] = _mm256_srai_epi16(_mm256_slli_epi16(_mm256_loadu_si256(poly_ptr + i), shift), shift);
+  }
+  forward_avx2<P0>(r);
+  for (size_t i = 0; i < BLOCK; i++) {
+    _mm256_storeu_si256(r0_ptr + i, r[i]);
+  }
+
+  for (size_t i = 0; i < BLOCK; i++) {
+    r[i] = _mm256_srai_epi16(_mm256_slli_epi16(_mm256_loadu_si256(poly_ptr + i), shift), shift);
+  }
+  forward_avx2<P1>(r);
+  for (size_t i = 0; i < BLOCK; i++) {
+    _mm256_storeu_si256(r1_ptr + i, r[i]);
+  }
+}
+
+// Multiplies two polynomials in NTT domain point-wise, accumulating result into `acc`,
+// using AVX2, see `mul_acc`.
+SABER_TARGET_AVX2 static inline void
+mul_acc_avx2(prod_t& acc, const eval_t& polya, const eval_t& polyb)
+{
+  const auto a0_ptr = reinterpret_cast<const __m256i*>(polya.r0.data());
+  const auto a1_ptr = reinterpret_cast<const __m256i*>(polya.r1.data());
+  const auto b0_ptr = reinterpret_cast<const __m256i*>(polyb.r0.data());
+  const auto b1_ptr = reinterpret_cast<const __m256i*>(polyb.r1.data());
+  const auto acc0_ptr = reinterpret_cast<__m256i*>(acc.r0.data());
+  const auto acc1_ptr = reinterpret_cast<__m256i*>(acc.r1.data());
+
+  const auto qinv0 = _mm256_set1_epi16(qinv<P0>());
+  const auto qinv1 = _mm256_set1_epi16(qinv<P1>());
+
+  for (size_t i = 0; i < BLOCK; i++) {
+    const auto b0 = _mm256_loadu_si256(b0_ptr + i);
+    const auto b1 = _mm256_loadu_si256(b1_ptr + i);
+
+    const auto t0 = mont_mul_avx2<P0>(_mm256_loadu_si256(a0_ptr + i), b0, _mm256_mullo_epi16(b0, qinv0));
+    const auto t1 = mont_mul_avx2<P1>(_mm256_loadu_si256(a1_ptr + i), b1, _mm256_mullo_epi16(b1, qinv1));
+
+    _mm256_storeu_si256(acc0_ptr + i, reduce_avx2<P0>(_mm256_add_epi16(_mm256_loadu_si256(acc0_ptr + i), t0)));
+    _mm256_storeu_si256(acc1_ptr + i, reduce_avx2<P1>(_mm256_add_epi16(_mm256_loadu_si256(acc1_ptr + i), t1)));
+  }
+}
+
+// Brings accumulated products back to coefficient form, using AVX2, see `interpolate`.
+SABER_TARGET_AVX2 static inline void
+interpolate_avx2(const prod_t& acc, std::array<zq::zq_t, N>& res)
+{
+  const auto acc0_ptr = reinterpret_cast<const __m256i*>(acc.r0.data());
+  const auto acc1_ptr = reinterpret_cast<const __m256i*>(acc.r1.data());
+  const auto res_ptr = reinterpret_cast<__m256i*>(res.data());
+
+  __m256i r[BLOCK];
+
+  for (size_t i = 0; i < BLOCK; i++) {
+    r[i] = _mm256_loadu_si256(acc0_ptr + i);
+  }
+  inverse_avx2<P0>(r);
+  for (size_t i = 0; i < BLOCK; i++) {
+    _mm256_storeu_si256(res_ptr + i, r[i]);
+  }
+
+  for (size_t i = 0; i < BLOCK; i++) {
+    r[i] = _mm256_loadu_si256(acc1_ptr + i);
+  }
+  inverse_avx2<P1>(r);
+
+  const auto k = _mm256_set1_epi16(INV_P0_MOD_P1);
+  const auto k_qinv = _mm256_mullo_epi16(k, _mm256_set1_epi16(qinv<P1>()));
+
+  for (size_t i = 0; i < BLOCK; i++) {
+    const auto r0 = _mm256_loadu_si256(res_ptr + i);
+    const auto t = reduce_avx2<P1>(mont_mul_avx2<P1>(_mm256_sub_epi16(r[i], r0), k, k_qinv));
+
+    _mm256_storeu_si256(res_ptr + i, _mm256_add_epi16(r0, _mm256_mullo_epi16(t, _mm256_set1_epi16(P0))));
+  }
+}
+
+#endif
+
+// Given a polynomial over Zq ( q = moduli <= 2^13 ), this routine lifts each of its
+// coefficients to centered representative and computes its NTT representation modulo
+// both primes, writing it to `res`. A secret polynomial, sampled with any of Saber's
+// parameter sets, is lifted to its signed coefficients, which are at most 5 in absolute
+// value.
+template<uint16_t moduli>
+static inline constexpr void
+evaluate(const std::array<zq::zq_t, N>& poly, eval_t& res)
+  requires(saber_params::is_power_of_2(moduli) && (moduli > 1) && (moduli <= MAX_MODULI))
+{
+#if defined SABER_DISPATCH
+  if (!std::is_constant_evaluated()) {
+    if (dispatch::has_avx2()) {
+      evaluate_avx2<moduli>(poly, res);
+      return;
+    }
+  }
+#endif
+
+  constexpr size_t shift = 16 - saber_params::log2(moduli);
+
+  for (size_t i = 0; i < N; i++) {
+    const auto v = static_cast<int16_t>(static_cast<uint16_t>(poly[i].as_raw() << shift)) >> shift;
+
+    res.r0[i] = static_cast<int16_t>(v);
+    res.r1[i] = static_cast<int16_t>(v);
+  }
+
+  forward<P0>(res.r0);
+  forward<P1>(res.r1);
+}
+
+// Computes NTT representation of a polynomial over Zq ( q = moduli ), see above.
+template<uint16_t moduli>
+static inline constexpr eval_t
+evaluate(const std::array<zq::zq_t, N>& poly)
+{
+  eval_t res;
+  evaluate<moduli>(poly, res);
+  return res;
+}
+
+// Multiplies two polynomials in NTT domain point-wise, accumulating result into `acc`,
+// which is kept reduced. One of them must be a public polynomial and the other one a
+// secret polynomial, see `MAX_TERMS`.
+static inline constexpr void
+mul_acc(prod_t& acc, const eval_t& polya, const eval_t& polyb)
+{
+#if defined SABER_DISPATCH
+  if (!std::is_constant_evaluated()) {
+    if (dispatch::has_avx2()) {
+      mul_acc_avx2(acc, polya, polyb);
+      return;
+    }
+  }
+#endif
+
+  for (size_t i = 0; i < N; i++) {
+    acc.r0[i] = reduce<P0>(static_cast<int16_t>(acc.r0[i] + mont_mul<P0>(polya.r0[i], polyb.r0[i])));
+    acc.r1[i] = reduce<P1>(static_cast<int16_t>(acc.r1[i] + mont_mul<P1>(polya.r1[i], polyb.r1[i])));
+  }
+}
+
+// Brings accumulated products back to coefficient form modulo both primes, reconstructs
+// exact ( centered ) integer coefficients using CRT and reduces them modulo 2^16,
+// producing polynomial over Zq.
+static inline constexpr std::array<zq::zq_t, N>
+interpolate(const prod_t& acc)
+{
+  std::array<zq::zq_t, N> res;
+
+#if defined SABER_DISPATCH
+  if (!std::is_constant_evaluated()) {
+    if (dispatch::has_avx2()) {
+      interpolate_avx2(acc, res);
+      return res;
+    }
+  }
+#endif
+
+  auto r0 = acc.r0;
+  auto r1 = acc.r1;
+
+  inverse<P0>(r0);
+  inverse<P1>(r1);
+
+  for (size_t i = 0; i < N; i++) {
+    res[i] = crt(r0[i], r1[i]);
+  }
+
+  return res;
+}
+
+// Small-secret multiplier, wrapped as a type ( see `polymul::domain_t` ), so that
+// matrix/ vector types can keep their elements in its evaluation domain.
+struct domain_t
+{
+  using eval_t = smallmul::eval_t;
+  using prod_t = smallmul::prod_t;
+
+  static constexpr uint16_t MAX_MODULI = smallmul::MAX_MODULI;
+
+  template<uint16_t moduli>
+  static inline constexpr void evaluate(const std::array<zq::zq_t, N>& poly, eval_t& res)
+  {
+    smallmul::evaluate<moduli>(poly, res);
+  }
+
+  template<uint16_t moduli>
+  static inline constexpr eval_t evaluate(const std::array<zq::zq_t, N>& poly)
+  {
+    return smallmul::evaluate<moduli>(poly);
+  }
+
+  static inline constexpr void mul_acc(prod_t& acc, const eval_t& polya, const eval_t& polyb) { smallmul::mul_acc(acc, polya, polyb); }
+
+  static inline constexpr std::array<zq::zq_t, N> interpolate(const prod_t& acc) { return smallmul::interpolate(acc); }
+};
+
+}
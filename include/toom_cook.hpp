@@ -0,0 +1,136 @@
+#pragma once
+#include "karatsuba.hpp"
+#include "params.hpp"
+#include "zq.hpp"
+#include <array>
+
+// Toom-Cook 4-way Multiplication of two Polynomials
+namespace toom_cook {
+
+// Interpolation step of Toom-Cook 4-way multiplication requires exact division by 2, 4
+// and 8 ( performed as logical right shift ), which loses top three bits of 16 -bit
+// coefficients. Hence multiplication result is correct only when reduced by some power
+// of 2 moduli <= 2^13.
+constexpr uint16_t MAX_MODULI = 1u << 13;
+
+// Multiplicative inverses of 3, 9 and 15, over Z_(2^16).
+constexpr zq::zq_t INV3(43691);
+constexpr zq::zq_t INV9(36409);
+constexpr zq::zq_t INV15(61167);
+
+// Given a polynomial of degree N-1 ( s.t. N is power of 2 and N >= 4 ), this routine
+// splits it into four limbs, each of N/4 coefficients, and evaluates the limb polynomial
+// at points {∞, 2, 1, -1, 1/2, -1/2, 0}, following
+// https://github.com/KULeuven-COSIC/SABER/blob/f7f39e4db2f3e22a21e1dd635e0601caae2b4510/Reference_Implementation_KEM/poly_mul.c.
+// Evaluations at ±1/2 are scaled up by 8, so that they stay integral.
+template<size_t N>
+static inline constexpr std::array<std::array<zq::zq_t, N / 4>, 7>
+evaluate(const std::array<zq::zq_t, N>& poly)
+  requires(saber_params::is_power_of_2(N) && (N >= 4))
+{
+  constexpr size_t Nby4 = N / 4;
+  std::array<std::array<zq::zq_t, Nby4>, 7> res;
+
+  for (size_t i = 0; i < Nby4; i++) {
+    const auto r0 = poly[i];
+    const auto r1 = poly[Nby4 + i];
+    const auto r2 = poly[2 * Nby4 + i];
+    const auto r3 = poly[3 * Nby4 + i];
+
+    const auto r02 = r0 + r2;
+    const auto r13 = r1 + r3;
+
+    const auto r02_h = ((r0 << 2) + r2) << 1;
+    const auto r13_h = (r1 << 2) + r3;
+
+    res[0][i] = r3;                                     // p(∞)
+    res[1][i] = (r3 << 3) + (r2 << 2) + (r1 << 1) + r0; // p(2)
+    res[2][i] = r02 + r13;                              // p(1)
+    res[3][i] = r02 - r13;                              // p(-1)
+    res[4][i] = r02_h + r13_h;                          // 8 * p(1/2)
+    res[5][i] = r02_h - r13_h;                          // 8 * p(-1/2)
+    res[6][i] = r0;                                     // p(0)
+  }
+
+  return res;
+}
+
+// Given seven point-wise products ( each of degree N/2-1 ), obtained by multiplying
+// evaluations of two polynomials, this routine interpolates them back to a polynomial of
+// degree 2*N-1 and reduces it modulo (x ** N + 1), following
+// https://github.com/KULeuven-COSIC/SABER/blob/f7f39e4db2f3e22a21e1dd635e0601caae2b4510/Reference_Implementation_KEM/poly_mul.c.
+template<size_t N>
+static inline constexpr std::array<zq::zq_t, N>
+interpolate(const std::array<std::array<zq::zq_t, N / 2>, 7>& prods)
+  requires(saber_params::is_power_of_2(N) && (N >= 4))
+{
+  constexpr size_t Nby4 = N / 4;
+  std::array<zq::zq_t, 2 * N> polyab{};
+
+  for (size_t i = 0; i < N / 2; i++) {
+    auto r0 = prods[0][i];
+    auto r1 = prods[1][i];
+    auto r2 = prods[2][i];
+    auto r3 = prods[3][i];
+    auto r4 = prods[4][i];
+    auto r5 = prods[5][i];
+    auto r6 = prods[6][i];
+
+    r1 = r1 + r4;
+    r5 = r5 - r4;
+    r3 = (r3 - r2) >> 1;
+    r4 = r4 - r0;
+    r4 = r4 - (r6 << 6);
+    r4 = (r4 << 1) + r5;
+    r2 = r2 + r3;
+    r1 = r1 - (r2 << 6) - r2;
+    r2 = r2 - r6;
+    r2 = r2 - r0;
+    r1 = r1 + zq::zq_t(45) * r2;
+    r4 = ((r4 - (r2 << 3)) * INV3) >> 3;
+    r5 = r5 + r1;
+    r1 = ((r1 + (r3 << 4)) * INV9) >> 1;
+    r3 = -(r3 + r1);
+    r5 = ((zq::zq_t(30) * r1 - r5) * INV15) >> 2;
+    r2 = r2 - r4;
+    r1 = r1 - r5;
+
+    polyab[i] += r6;
+    polyab[Nby4 + i] += r5;
+    polyab[2 * Nby4 + i] += r4;
+    polyab[3 * Nby4 + i] += r3;
+    polyab[4 * Nby4 + i] += r2;
+    polyab[5 * Nby4 + i] += r1;
+    polyab[6 * Nby4 + i] += r0;
+  }
+
+  std::array<zq::zq_t, N> res;
+  for (size_t i = 0; i < N; i++) {
+    res[i] = polyab[i] - polyab[N + i];
+  }
+
+  return res;
+}
+
+// Given two polynomials of degree N-1 ( s.t. N is power of 2 and N >= 4 ), this
+// routine multiplies them using Toom-Cook 4-way algorithm, computing seven point-wise
+// limb products using Karatsuba algorithm, and reduces result modulo (x ** N + 1).
+//
+// Note, only lowest 13 -bits of each resulting coefficient are correct, see `MAX_MODULI`.
+template<size_t N>
+static inline constexpr std::array<zq::zq_t, N>
+toom4mul(const std::array<zq::zq_t, N>& polya, const std::array<zq::zq_t, N>& polyb)
+  requires(saber_params::is_power_of_2(N) && (N >= 4))
+{
+  const auto evala = evaluate(polya);
+  const auto evalb = evaluate(polyb);
+
+  zq::uninit_t<std::array<std::array<zq::zq_t, N / 2>, 7>> prods;
+  for (size_t i = 0; i < prods.v.size(); i++) {
+    prods.v[i] = karatsuba::karatsuba(evala[i], evalb[i]);
+  }
+
+  return interpolate<N>(prods.v);
+}
+
+}
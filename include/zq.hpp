@@ -10,7 +10,7 @@ namespace zq {
 struct zq_t
 {
 private:
-  uint16_t val = 0;
+  uint16_t val{};
 
 public:
   //  Constructors
@@ -59,4 +59,15 @@ public:
   }
 };
 
+// Storage for an object of type `T` ( say an array of Zq elements ), which is left
+// uninitialized on construction, unlike a default constructed `zq_t`, which is always
+// zero. Meant only for internal scratch buffers, which are fully overwritten right after
+// declaration, so that they don't pay for zeroing. Object is accessed through `v`.
+template<typename T>
+union uninit_t
+{
+  T v;
+  inline constexpr uninit_t() {}
+};
+
 }
@@ -0,0 +1,235 @@
+#include "keccak_batch.hpp"
+#include "poly_matrix.hpp"
+#include "prng.hpp"
+#include "sha3_256.hpp"
+#include "sha3_512.hpp"
+#include "shake128.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+// Ensure that each instance of multi-buffer SHAKE128 produces same output, as scalar
+// SHAKE128 does, for same message, while message is absorbed and output is squeezed in
+// chunks of arbitrary length, so that both sub-word and multi-block paths are exercised.
+template<size_t lanes>
+void
+test_shake128_batch(const size_t mlen, const size_t olen)
+{
+  std::array<std::vector<uint8_t>, lanes> msgs;
+  std::array<std::vector<uint8_t>, lanes> outs;
+  std::vector<uint8_t> expected(olen, 0);
+
+  prng::prng_t prng;
+  for (size_t k = 0; k < lanes; k++) {
+    msgs[k].resize(mlen);
+    outs[k].resize(olen);
+    prng.read(msgs[k]);
+  }
+
+  keccak_batch::shake128_t<lanes> hasher;
+
+  for (size_t i = 0; i < mlen;) {
+    const size_t len = std::min((i % 13) + 1, mlen - i);
+
+    std::array<std::span<const uint8_t>, lanes> chunks;
+    for (size_t k = 0; k < lanes; k++) {
+      chunks[k] = std::span(msgs[k]).subspan(i, len);
+    }
+    hasher.absorb(chunks);
+    i += len;
+  }
+  hasher.finalize();
+
+  for (size_t i = 0; i < olen;) {
+    const size_t len = std::min((i % 29) + 1, olen - i);
+
+    std::array<std::span<uint8_t>, lanes> chunks;
+    for (size_t k = 0; k < lanes; k++) {
+      chunks[k] = std::span(outs[k]).subspan(i, len);
+    }
+    hasher.squeeze(chunks);
+    i += len;
+  }
+
+  for (size_t k = 0; k < lanes; k++) {
+    shake128::shake128_t scalar;
+    scalar.absorb(msgs[k]);
+    scalar.finalize();
+    scalar.squeeze(expected);
+
+    EXPECT_EQ(outs[k], expected);
+  }
+}
+
+// Ensure that each instance of multi-buffer SHA3-256 and SHA3-512 produces same digest,
+// as scalar SHA3 does, for same message.
+template<size_t lanes>
+void
+test_sha3_batch(const size_t mlen)
+{
+  std::array<std::vector<uint8_t>, lanes> msgs;
+  std::array<std::array<uint8_t, sha3_256::DIGEST_LEN>, lanes> digests256;
+  std::array<std::array<uint8_t, sha3_512::DIGEST_LEN>, lanes> digests512;
+
+  prng::prng_t prng;
+  for (size_t k = 0; k < lanes; k++) {
+    msgs[k].resize(mlen);
+    prng.read(msgs[k]);
+  }
+
+  std::array<std::span<const uint8_t>, lanes> _msgs;
+  std::array<std::span<uint8_t>, lanes> _digests256;
+  std::array<std::span<uint8_t>, lanes> _digests512;
+  for (size_t k = 0; k < lanes; k++) {
+    _msgs[k] = msgs[k];
+    _digests256[k] = digests256[k];
+    _digests512[k] = digests512[k];
+  }
+
+  keccak_batch::sha3_256_t<lanes> h256;
+  h256.absorb(_msgs);
+  h256.finalize();
+  h256.squeeze(_digests256);
+
+  keccak_batch::sha3_512_t<lanes> h512;
+  h512.absorb(_msgs);
+  h512.finalize();
+  h512.squeeze(_digests512);
+
+  for (size_t k = 0; k < lanes; k++) {
+    std::array<uint8_t, sha3_256::DIGEST_LEN> expected256;
+    std::array<uint8_t, sha3_512::DIGEST_LEN> expected512;
+
+    sha3_256::sha3_256_t s256;
+    s256.absorb(msgs[k]);
+    s256.finalize();
+    s256.digest(expected256);
+
+    sha3_512::sha3_512_t s512;
+    s512.absorb(msgs[k]);
+    s512.finalize();
+    s512.digest(expected512);
+
+    EXPECT_EQ(digests256[k], expected256);
+    EXPECT_EQ(digests512[k], expected512);
+  }
+}
+
+// Ensure that one-shot hashing of messages of different lengths, using multi-buffer
+// SHA3-256, produces same digests, as scalar SHA3-256 does.
+template<size_t lanes>
+void
+test_sha3_256_hash(const size_t mlen)
+{
+  std::array<std::vector<uint8_t>, lanes> msgs;
+  std::array<std::array<uint8_t, sha3_256::DIGEST_LEN>, lanes> digests;
+
+  std::array<std::span<const uint8_t>, lanes> _msgs;
+  std::array<std::span<uint8_t>, lanes> _digests;
+
+  prng::prng_t prng;
+  for (size_t k = 0; k < lanes; k++) {
+    msgs[k].resize(mlen * k + k);
+    prng.read(msgs[k]);
+
+    _msgs[k] = msgs[k];
+    _digests[k] = digests[k];
+  }
+
+  keccak_batch::sha3_256_t<lanes>::hash(_msgs, _digests);
+
+  for (size_t k = 0; k < lanes; k++) {
+    std::array<uint8_t, sha3_256::DIGEST_LEN> expected;
+
+    sha3_256::sha3_256_t s256;
+    s256.absorb(msgs[k]);
+    s256.finalize();
+    s256.digest(expected);
+
+    EXPECT_EQ(digests[k], expected);
+  }
+}
+
+TEST(SaberKEM, BatchedKeccak)
+{
+  for (size_t mlen = 0; mlen <= 400; mlen += 23) {
+    test_shake128_batch<1>(mlen, 3 * 168 + 5);
+    test_shake128_batch<2>(mlen, 3 * 168 + 5);
+    test_shake128_batch<4>(mlen, 3 * 168 + 5);
+    test_shake128_batch<8>(mlen, 3 * 168 + 5);
+
+    test_sha3_batch<2>(mlen);
+    test_sha3_batch<4>(mlen);
+    test_sha3_batch<8>(mlen);
+
+    test_sha3_256_hash<2>(mlen);
+    test_sha3_256_hash<4>(mlen);
+  }
+
+  // Message of exactly one block
+  test_sha3_batch<4>(136);
+  test_sha3_batch<4>(72);
+
+#if !defined NDEBUG
+  // Messages absorbed in a single call must be of same length
+  std::array<uint8_t, 16> longer{};
+  std::array<uint8_t, 8> shorter{};
+
+  keccak_batch::shake128_t<2> hasher;
+  EXPECT_DEATH(hasher.absorb({ longer, shorter }), "");
+#endif
+}
+
+// Ensure that batched matrix expansion and secret sampling produce same matrices/ vectors,
+// as their scalar counterparts do, from same seeds.
+template<size_t L, uint16_t moduli, size_t mu, bool uniform_sampling, size_t lanes>
+void
+test_gen_batch()
+{
+  constexpr size_t seedBytes = 32;
+
+  std::array<std::array<uint8_t, seedBytes>, lanes> seeds;
+  std::array<std::span<const uint8_t>, lanes> _seeds;
+
+  prng::prng_t prng;
+  for (size_t k = 0; k < lanes; k++) {
+    prng.read(seeds[k]);
+    _seeds[k] = seeds[k];
+  }
+
+  using matrix_t = mat::poly_matrix_t<L, L, moduli>;
+  using vector_t = mat::poly_matrix_t<L, 1, moduli>;
+
+  const auto mats = matrix_t::template gen_matrix_batch<lanes>(_seeds);
+  const auto vecs = vector_t::template gen_secret_batch<uniform_sampling, mu, lanes>(_seeds);
+
+  for (size_t k = 0; k < lanes; k++) {
+    const auto seed = std::span<const uint8_t, seedBytes>(seeds[k]);
+    const auto mat = matrix_t::template gen_matrix<seedBytes>(seed);
+    const auto vec = vector_t::template gen_secret<uniform_sampling, seedBytes, mu>(seed);
+
+    for (size_t i = 0; i < L; i++) {
+      for (size_t j = 0; j < L; j++) {
+        const auto& expected = mat[{ i, j }];
+        const auto& computed = mats[k][{ i, j }];
+
+        for (size_t c = 0; c < poly::N; c++) {
+          EXPECT_EQ(expected[c].as_raw(), computed[c].as_raw());
+        }
+      }
+
+      for (size_t c = 0; c < poly::N; c++) {
+        EXPECT_EQ(vec[i][c].as_raw(), vecs[k][i][c].as_raw());
+      }
+    }
+  }
+}
+
+TEST(SaberKEM, BatchedMatrixExpansion)
+{
+  test_gen_batch<2, (1 << 13), 10, false, 4>(); // lightsaber
+  test_gen_batch<3, (1 << 13), 8, false, 4>();  // saber
+  test_gen_batch<4, (1 << 13), 6, false, 4>();  // firesaber
+  test_gen_batch<2, (1 << 12), 2, true, 4>();   // uLightsaber
+  test_gen_batch<3, (1 << 12), 2, true, 8>();   // uSaber
+  test_gen_batch<4, (1 << 12), 2, true, 2>();   // uFiresaber
+}
@@ -59,6 +59,106 @@ test_saber_kem()
   _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_ctxt, _skey, _seskey_b);
 
   EXPECT_EQ(seskey_a, seskey_b);
+
+  // Encapsulating against a prepared public key must produce same cipher text and
+  // session key
+  std::vector<uint8_t> ctxt_prep(ctlen);
+  std::vector<uint8_t> seskey_prep(sslen);
+
+  const _saber_kem::prepared_pkey_t<L, EQ, EP, seedBytes> pkey_prep(_pkey);
+  _saber_kem::encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(
+    _m, pkey_prep, std::span<uint8_t, ctlen>(ctxt_prep), std::span<uint8_t, sslen>(seskey_prep));
+
+  EXPECT_EQ(ctxt, ctxt_prep);
+  EXPECT_EQ(seskey_a, seskey_prep);
+
+  // Decapsulating under a prepared secret key must produce same session key, both for
+  // valid and tampered cipher text
+  const _saber_kem::prepared_skey_t<L, EQ, EP, seedBytes, keyBytes> skey_prep(_skey);
+  _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_ctxt, skey_prep, std::span<uint8_t, sslen>(seskey_prep));
+  EXPECT_EQ(seskey_a, seskey_prep);
+
+  ctxt[0] ^= 1;
+  _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_ctxt, _skey, _seskey_b);
+  _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(_ctxt, skey_prep, std::span<uint8_t, sslen>(seskey_prep));
+  EXPECT_NE(seskey_a, seskey_b);
+  EXPECT_EQ(seskey_b, seskey_prep);
+}
+
+// Ensure that batched Saber KEM algorithms produce same keypairs, cipher texts and
+// session keys, as calling their scalar counterparts for each operation does, both for
+// valid and tampered cipher texts, while n is chosen s.t. both batched groups and
+// remaining operations are exercised.
+template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, size_t keyBytes, bool uniform_sampling, size_t n>
+void
+test_saber_kem_batch()
+{
+  constexpr size_t pklen = saber_utils::kem_pklen<L, EP, seedBytes>();
+  constexpr size_t sklen = saber_utils::kem_sklen<L, EQ, EP, seedBytes, keyBytes>();
+  constexpr size_t ctlen = saber_utils::kem_ctlen<L, EP, ET>();
+  constexpr size_t sslen = sha3_256::DIGEST_LEN;
+
+  std::vector<uint8_t> seedA(n * seedBytes);
+  std::vector<uint8_t> seedS(n * noiseBytes);
+  std::vector<uint8_t> z(n * keyBytes);
+  std::vector<uint8_t> m(n * keyBytes);
+  std::vector<uint8_t> pkey(n * pklen);
+  std::vector<uint8_t> skey(n * sklen);
+  std::vector<uint8_t> ctxt(n * ctlen);
+  std::vector<uint8_t> seskey_a(n * sslen);
+  std::vector<uint8_t> seskey_b(n * sslen);
+
+  prng::prng_t prng;
+
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(z);
+  prng.read(m);
+
+  _saber_kem::keygen_batch<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling, n>(std::span<const uint8_t, n * seedBytes>(seedA),
+                                                                                                std::span<const uint8_t, n * noiseBytes>(seedS),
+                                                                                                std::span<const uint8_t, n * keyBytes>(z),
+                                                                                                std::span<uint8_t, n * pklen>(pkey),
+                                                                                                std::span<uint8_t, n * sklen>(skey));
+  _saber_kem::encaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, n>(std::span<const uint8_t, n * keyBytes>(m),
+                                                                                        std::span<const uint8_t, n * pklen>(pkey),
+                                                                                        std::span<uint8_t, n * ctlen>(ctxt),
+                                                                                        std::span<uint8_t, n * sslen>(seskey_a));
+
+  // Tamper cipher texts, both in a batched group and among remaining ones
+  ctxt[0] ^= 1;
+  ctxt[(n - 1) * ctlen] ^= 1;
+
+  _saber_kem::decaps_batch<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling, n>(
+    std::span<const uint8_t, n * ctlen>(ctxt), std::span<const uint8_t, n * sklen>(skey), std::span<uint8_t, n * sslen>(seskey_b));
+
+  for (size_t i = 0; i < n; i++) {
+    std::array<uint8_t, pklen> pkey_;
+    std::array<uint8_t, sklen> skey_;
+    std::array<uint8_t, ctlen> ctxt_;
+    std::array<uint8_t, sslen> seskey_a_;
+    std::array<uint8_t, sslen> seskey_b_;
+
+    _saber_kem::keygen<L, EQ, EP, MU, seedBytes, noiseBytes, keyBytes, uniform_sampling>(std::span<const uint8_t, seedBytes>(seedA.data() + i * seedBytes, seedBytes),
+                                                                                         std::span<const uint8_t, noiseBytes>(seedS.data() + i * noiseBytes, noiseBytes),
+                                                                                         std::span<const uint8_t, keyBytes>(z.data() + i * keyBytes, keyBytes),
+                                                                                         pkey_,
+                                                                                         skey_);
+    _saber_kem::encaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(
+      std::span<const uint8_t, keyBytes>(m.data() + i * keyBytes, keyBytes), pkey_, ctxt_, seskey_a_);
+
+    if ((i == 0) || (i == n - 1)) {
+      ctxt_[0] ^= 1;
+    }
+    _saber_kem::decaps<L, EQ, EP, ET, MU, seedBytes, keyBytes, uniform_sampling>(ctxt_, skey_, seskey_b_);
+
+    EXPECT_TRUE(std::equal(pkey_.begin(), pkey_.end(), pkey.begin() + i * pklen));
+    EXPECT_TRUE(std::equal(skey_.begin(), skey_.end(), skey.begin() + i * sklen));
+    EXPECT_TRUE(std::equal(ctxt_.begin(), ctxt_.end(), ctxt.begin() + i * ctlen));
+    EXPECT_TRUE(std::equal(seskey_a_.begin(), seskey_a_.end(), seskey_a.begin() + i * sslen));
+    EXPECT_TRUE(std::equal(seskey_b_.begin(), seskey_b_.end(), seskey_b.begin() + i * sslen));
+    EXPECT_EQ((i == 0) || (i == n - 1), seskey_a_ != seskey_b_);
+  }
 }
 
 // Ensure functional correctness and conformance of LightSaber KEM scheme, using known
@@ -685,6 +785,16 @@ TEST(SaberKEM, uFireSaberKeyEncapsulationMechanism)
   test_saber_kem<4, 12, 10, 6, 2, 32, 32, 32, true>();
 }
 
+TEST(SaberKEM, BatchedKeyEncapsulationMechanism)
+{
+  test_saber_kem_batch<2, 13, 10, 3, 10, 32, 32, 32, false, 6>(); // lightsaber
+  test_saber_kem_batch<3, 13, 10, 4, 8, 32, 32, 32, false, 6>();  // saber
+  test_saber_kem_batch<4, 13, 10, 6, 6, 32, 32, 32, false, 6>();  // firesaber
+  test_saber_kem_batch<2, 12, 10, 3, 2, 32, 32, 32, true, 5>();   // uLightsaber
+  test_saber_kem_batch<3, 12, 10, 4, 2, 32, 32, 32, true, 4>();   // uSaber
+  test_saber_kem_batch<4, 12, 10, 6, 2, 32, 32, 32, true, 7>();   // uFiresaber
+}
+
 TEST(SaberKEM, LightSaberKnownAnswerTests)
 {
   kat_lightsaber();
@@ -0,0 +1,39 @@
+#include "parallel.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+// Ensure that worker pool runs each task of a job exactly once, before returning, for jobs
+// posted one after another, for nested jobs ( posted from within a task ) and for a pool
+// without any worker thread.
+template<size_t workers>
+void
+test_pool()
+{
+  parallel::pool_t<workers> pool;
+
+  for (size_t count = 0; count <= 9; count++) {
+    std::vector<size_t> hits(count, 0);
+    pool.run(count, [&](const size_t i) { hits[i]++; });
+
+    EXPECT_EQ(hits, std::vector<size_t>(count, 1));
+  }
+
+  constexpr size_t outer = 5;
+  constexpr size_t inner = 7;
+
+  std::vector<size_t> hits(outer * inner, 0);
+  pool.run(outer, [&](const size_t i) { pool.run(inner, [&](const size_t j) { hits[i * inner + j]++; }); });
+
+  EXPECT_EQ(hits, std::vector<size_t>(outer * inner, 1));
+}
+
+TEST(SaberKEM, WorkerPool)
+{
+  test_pool<0>();
+  test_pool<1>();
+  test_pool<3>();
+
+  std::vector<size_t> hits(4, 0);
+  parallel::for_each(hits.size(), [&](const size_t i) { hits[i]++; });
+  EXPECT_EQ(hits, std::vector<size_t>(4, 1));
+}
@@ -10,6 +10,7 @@
 // - encrypting a 32 -bytes message using public key
 // - decrypting the cipher text using secret key
 // - asserting equality of original message and decrypted one
+// - asserting that keys, kept in evaluation domain, produce same cipher text and message
 template<size_t L, size_t EQ, size_t EP, size_t ET, size_t MU, size_t seedBytes, size_t noiseBytes, bool uniform_sampling>
 void
 test_saber_pke()
@@ -27,6 +28,8 @@ test_saber_pke()
   std::vector<uint8_t> pkey(pklen);
   std::vector<uint8_t> skey(sklen);
   std::vector<uint8_t> ctxt(ctlen);
+  std::vector<uint8_t> ctxt_hat(ctlen);
+  std::vector<uint8_t> dec_hat(mlen, 0);
 
   prng::prng_t prng;
 
@@ -43,12 +46,22 @@ test_saber_pke()
   auto _pkey = std::span<uint8_t, pklen>(pkey);
   auto _skey = std::span<uint8_t, sklen>(skey);
   auto _ctxt = std::span<uint8_t, ctlen>(ctxt);
+  auto _ctxt_hat = std::span<uint8_t, ctlen>(ctxt_hat);
+  auto _dec_hat = std::span<uint8_t, mlen>(dec_hat);
 
   saber_pke::keygen<L, EQ, EP, MU, seedBytes, noiseBytes, uniform_sampling>(_seedA, _seedS, _pkey, _skey);
   saber_pke::encrypt<L, EQ, EP, ET, MU, seedBytes, uniform_sampling>(_msg, _seedS_prm, _pkey, _ctxt);
   saber_pke::decrypt<L, EQ, EP, ET, MU, uniform_sampling>(_ctxt, _skey, _dec);
 
+  const saber_pke::pkey_eval_t<L, EQ, EP, seedBytes> pkey_hat(_pkey);
+  const saber_pke::skey_eval_t<L, EQ> skey_hat(_skey);
+
+  saber_pke::encrypt<L, EQ, EP, ET, MU, seedBytes, uniform_sampling>(_msg, _seedS_prm, pkey_hat, _ctxt_hat);
+  saber_pke::decrypt<L, EQ, EP, ET, MU, uniform_sampling>(_ctxt_hat, skey_hat, _dec_hat);
+
   EXPECT_EQ(msg, dec);
+  EXPECT_EQ(ctxt, ctxt_hat);
+  EXPECT_EQ(msg, dec_hat);
 }
 
 TEST(SaberKEM, LightSaberPublicKeyEncryption)
@@ -1,5 +1,6 @@
 #include "poly_matrix.hpp"
 #include "prng.hpp"
+#include "smallmul.hpp"
 #include <gtest/gtest.h>
 #include <vector>
 
@@ -52,3 +53,234 @@ TEST(SaberKEM, PolynomialMatrixConversion)
   test_poly_matrix_conversion<3, (1 << 12)>(); // uSaber
   test_poly_matrix_conversion<4, (1 << 12)>(); // uFiresaber
 }
+
+// Ensure that lazily evaluated expressions over vectors of polynomials compute same
+// elements, as evaluating same expression over each element polynomial.
+template<size_t rows>
+void
+test_poly_matrix_expr()
+{
+  constexpr uint16_t Q = 1 << 13;
+  constexpr uint16_t P = 1 << 10;
+  constexpr size_t vblen = rows * (saber_params::log2(Q) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr(vblen, 0);
+  prng::prng_t prng;
+
+  prng.read(bstr);
+  mat::poly_matrix_t<rows, 1, Q> u(bstr);
+  prng.read(bstr);
+  mat::poly_matrix_t<rows, 1, Q> v(bstr);
+
+  const mat::poly_matrix_t<rows, 1, P> w = ((u + v) >> 3).template mod<P>();
+
+  std::vector<uint8_t> expected(rows * (saber_params::log2(P) * poly::N) / 8, 0);
+  std::vector<uint8_t> computed(expected.size(), 0);
+
+  for (size_t i = 0; i < rows; i++) {
+    const poly::poly_t<P> wi = ((u[i] + v[i]) >> 3).template mod<P>();
+    for (size_t k = 0; k < poly::N; k++) {
+      EXPECT_EQ(wi[k].as_raw(), w[i][k].as_raw());
+    }
+  }
+
+  w.to_bytes(expected);
+  ((u + v) >> 3).template mod<P>().to_bytes(computed);
+  EXPECT_EQ(expected, computed);
+
+  // In-place operators, taking either a matrix or an expression as right hand side
+  mat::poly_matrix_t<rows, 1, Q> x = u;
+  ((x += (v << 1)) -= u) >>= 2;
+  x <<= 1;
+  for (size_t i = 0; i < rows; i++) {
+    const poly::poly_t<Q> xi = ((((u[i] + (v[i] << 1)) - u[i]) >> 2) << 1);
+    for (size_t k = 0; k < poly::N; k++) {
+      EXPECT_EQ(xi[k].as_raw(), x[i][k].as_raw());
+    }
+  }
+}
+
+TEST(SaberKEM, PolynomialMatrixExpressions)
+{
+  test_poly_matrix_expr<2>();
+  test_poly_matrix_expr<3>();
+  test_poly_matrix_expr<4>();
+}
+
+// Ensure that matrix vector multiplication and inner product, which accumulate products
+// in evaluation domain of selected polynomial multiplication backend, compute same
+// result as sum of individual polynomial products.
+template<size_t rows, uint16_t moduli>
+void
+test_poly_matrix_mul()
+{
+  constexpr size_t pblen = (saber_params::log2(moduli) * poly::N) / 8;
+  constexpr size_t vblen = rows * pblen;
+
+  std::array<uint8_t, 32> seed{};
+  std::vector<uint8_t> vec_bstr(vblen, 0);
+
+  prng::prng_t prng;
+  prng.read(seed);
+  prng.read(vec_bstr);
+
+  auto mat = mat::poly_matrix_t<rows, rows, moduli>::template gen_matrix<seed.size()>(seed);
+  mat::poly_matrix_t<rows, 1, moduli> vec(vec_bstr);
+
+  const auto mv = mat.mat_vec_mul(vec);
+  const auto ip = vec.inner_prod(vec);
+
+  // Same matrix, in coefficient-major layout
+  const mat::poly_matrix_cm_t<rows, rows, moduli> mat_cm(mat);
+  const auto mv_cm = mat_cm.mat_vec_mul(vec);
+
+  // Same matrix, expanded from seed, while being multiplied
+  const auto mv_stream = mat::poly_matrix_t<rows, rows, moduli>::template gen_matrix_vec_mul<seed.size()>(seed, vec.evaluate());
+
+  // Transpose of same matrix, expanded from seed, while being multiplied
+  const auto mtv = mat.transpose().mat_vec_mul(vec);
+  const auto mtv_stream = mat::poly_matrix_t<rows, rows, moduli>::template gen_matrix_vec_mul<seed.size(), true>(seed, vec.evaluate());
+  const auto mat_rt = mat_cm.to_matrix();
+
+  poly::poly_t<moduli> expected_ip{};
+  for (size_t i = 0; i < rows; i++) {
+    poly::poly_t<moduli> expected_mv{};
+    for (size_t j = 0; j < rows; j++) {
+      expected_mv += mat[{ i, j }] * vec[j];
+    }
+    expected_ip += vec[i] * vec[i];
+
+    for (size_t k = 0; k < poly::N; k++) {
+      EXPECT_EQ(expected_mv[k].template reduce_by<moduli>().as_raw(), mv[i][k].template reduce_by<moduli>().as_raw());
+      EXPECT_EQ(expected_mv[k].template reduce_by<moduli>().as_raw(), mv_cm[i][k].template reduce_by<moduli>().as_raw());
+      EXPECT_EQ(expected_mv[k].template reduce_by<moduli>().as_raw(), mv_stream[i][k].template reduce_by<moduli>().as_raw());
+      EXPECT_EQ(mtv[i][k].template reduce_by<moduli>().as_raw(), mtv_stream[i][k].template reduce_by<moduli>().as_raw());
+    }
+
+    for (size_t j = 0; j < rows; j++) {
+      const auto& elem = mat[{ i, j }];
+      const auto& elem_rt = mat_rt[{ i, j }];
+
+      // Element polynomials must be cache line aligned
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(&elem[0]) % poly::ALIGNMENT, 0ul);
+
+      for (size_t k = 0; k < poly::N; k++) {
+        EXPECT_EQ(elem[k].as_raw(), mat_cm(i * rows + j, k).as_raw());
+        EXPECT_EQ(elem[k].as_raw(), elem_rt[k].as_raw());
+      }
+    }
+  }
+
+  for (size_t k = 0; k < poly::N; k++) {
+    EXPECT_EQ(expected_ip[k].template reduce_by<moduli>().as_raw(), ip[k].template reduce_by<moduli>().as_raw());
+  }
+}
+
+TEST(SaberKEM, PolynomialMatrixMultiplication)
+{
+  test_poly_matrix_mul<2, (1 << 13)>(); // lightsaber
+  test_poly_matrix_mul<3, (1 << 13)>(); // saber
+  test_poly_matrix_mul<4, (1 << 13)>(); // firesaber
+  test_poly_matrix_mul<3, (1 << 10)>();
+}
+
+// Ensure that products of public matrix/ vector and secret vector ( as sampled by
+// `gen_secret` ), computed in evaluation domain of small-secret multiplier, match same
+// products, computed by general purpose multiplier.
+template<size_t rows, bool uniform_sampling, size_t mu>
+void
+test_secret_poly_matrix_mul()
+{
+  constexpr uint16_t Q = 1u << 13;
+  constexpr uint16_t P = 1u << 10;
+  constexpr size_t vblen = (saber_params::log2(P) * poly::N * rows) / 8;
+
+  using domain_t = smallmul::domain_t;
+
+  std::array<uint8_t, 32> seedA{};
+  std::array<uint8_t, 32> seedS{};
+  std::vector<uint8_t> vec_bstr(vblen, 0);
+
+  prng::prng_t prng;
+  prng.read(seedA);
+  prng.read(seedS);
+  prng.read(vec_bstr);
+
+  auto mat = mat::poly_matrix_t<rows, rows, Q>::template gen_matrix<seedA.size()>(seedA);
+  const auto s = mat::poly_matrix_t<rows, 1, Q>::template gen_secret<uniform_sampling, seedS.size(), mu>(seedS);
+  const mat::poly_matrix_t<rows, 1, P> b(vec_bstr);
+
+  const auto s_hat = s.template evaluate<domain_t>();
+
+  const auto mv = mat.template evaluate<domain_t>().template mat_vec_mul<Q>(s_hat);
+  const auto mv_stream = mat::poly_matrix_t<rows, rows, Q>::template gen_matrix_vec_mul<seedA.size()>(seedA, s_hat);
+  const auto mtv_stream = mat::poly_matrix_t<rows, rows, Q>::template gen_matrix_vec_mul<seedA.size(), true>(seedA, s_hat);
+  const auto ip = b.template evaluate<domain_t>().template inner_prod<P>(s_hat);
+
+  const auto expected_mv = mat.mat_vec_mul(s);
+  const auto expected_mtv = mat.transpose().mat_vec_mul(s);
+
+  poly::poly_t<P> expected_ip{};
+  for (size_t i = 0; i < rows; i++) {
+    expected_ip += b[i] * poly::poly_t<P>(s[i].as_array());
+  }
+
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t k = 0; k < poly::N; k++) {
+      EXPECT_EQ(expected_mv[i][k].template reduce_by<Q>().as_raw(), mv[i][k].template reduce_by<Q>().as_raw());
+      EXPECT_EQ(expected_mv[i][k].template reduce_by<Q>().as_raw(), mv_stream[i][k].template reduce_by<Q>().as_raw());
+      EXPECT_EQ(expected_mtv[i][k].template reduce_by<Q>().as_raw(), mtv_stream[i][k].template reduce_by<Q>().as_raw());
+    }
+  }
+
+  for (size_t k = 0; k < poly::N; k++) {
+    EXPECT_EQ(expected_ip[k].template reduce_by<P>().as_raw(), ip[k].template reduce_by<P>().as_raw());
+  }
+}
+
+// Ensure that small-secret multiplier stays exact, when products reach their bound i.e.
+// all public coefficients are -q/2 and all secret coefficients are -5, so that last
+// coefficient of each output polynomial is l * N * q/2 * 5.
+template<size_t rows>
+void
+test_secret_poly_matrix_mul_bound()
+{
+  constexpr uint16_t Q = 1u << 13;
+
+  using domain_t = smallmul::domain_t;
+
+  mat::poly_matrix_t<rows, rows, Q> mat;
+  mat::poly_matrix_t<rows, 1, Q> s;
+
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t k = 0; k < poly::N; k++) {
+      for (size_t j = 0; j < rows; j++) {
+        mat[{ i, j }][k] = Q / 2;
+      }
+      s[i][k] = Q - 5;
+    }
+  }
+
+  const auto mv = mat.template evaluate<domain_t>().template mat_vec_mul<Q>(s.template evaluate<domain_t>());
+  const auto expected_mv = mat.mat_vec_mul(s);
+
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t k = 0; k < poly::N; k++) {
+      EXPECT_EQ(expected_mv[i][k].template reduce_by<Q>().as_raw(), mv[i][k].template reduce_by<Q>().as_raw());
+    }
+  }
+}
+
+TEST(SaberKEM, SecretPolynomialMatrixMultiplication)
+{
+  test_secret_poly_matrix_mul<2, false, 10>(); // lightsaber
+  test_secret_poly_matrix_mul<3, false, 8>();  // saber
+  test_secret_poly_matrix_mul<4, false, 6>();  // firesaber
+  test_secret_poly_matrix_mul<2, true, 2>();   // ulightsaber
+  test_secret_poly_matrix_mul<3, true, 2>();   // usaber
+  test_secret_poly_matrix_mul<4, true, 2>();   // ufiresaber
+
+  test_secret_poly_matrix_mul_bound<2>();
+  test_secret_poly_matrix_mul_bound<3>();
+  test_secret_poly_matrix_mul_bound<4>();
+}
@@ -1,5 +1,10 @@
+#include "poly_compact.hpp"
+#include "polymul_batch.hpp"
 #include "polynomial.hpp"
 #include "prng.hpp"
+#include "sampling.hpp"
+#include "schoolbook.hpp"
+#include <cstring>
 #include <gtest/gtest.h>
 #include <vector>
 
@@ -24,6 +29,53 @@ test_poly_conversion()
   poly.to_bytes(dst_bstr);
 
   EXPECT_EQ(src_bstr, dst_bstr);
+
+  // Portable implementation must agree with the one selected at runtime
+  poly::poly_t<moduli> poly_generic;
+  poly_generic.from_bytes_generic(src_bstr);
+  poly_generic.to_bytes_generic(dst_bstr);
+
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(poly_generic[i].as_raw(), poly[i].as_raw());
+  }
+  EXPECT_EQ(src_bstr, dst_bstr);
+
+#if defined SABER_DISPATCH
+  constexpr size_t w = saber_params::log2(moduli);
+
+  // Coefficients not reduced by `moduli` must be masked, while packing
+  std::array<zq::zq_t, poly::N> wide;
+  std::vector<uint8_t> wide_bstr(poly::N * 2);
+  prng.read(wide_bstr);
+
+  for (size_t i = 0; i < poly::N; i++) {
+    wide[i] = static_cast<uint16_t>(wide_bstr[2 * i] | (wide_bstr[2 * i + 1] << 8));
+  }
+
+  std::vector<uint8_t> expected_bstr(blen, 0);
+  poly::poly_t<moduli>(wide).to_bytes_generic(expected_bstr);
+
+  std::array<zq::zq_t, poly::N> computed;
+
+  if (dispatch::has_bmi2()) {
+    bitpack::unpack_bmi2<w>(src_bstr, computed);
+    for (size_t i = 0; i < poly::N; i++) {
+      EXPECT_EQ(poly_generic[i].as_raw(), computed[i].as_raw());
+    }
+
+    bitpack::pack_bmi2<w>(wide, dst_bstr);
+    EXPECT_EQ(expected_bstr, dst_bstr);
+  }
+  if (dispatch::has_avx2()) {
+    bitpack::unpack_avx2<w>(src_bstr, computed);
+    for (size_t i = 0; i < poly::N; i++) {
+      EXPECT_EQ(poly_generic[i].as_raw(), computed[i].as_raw());
+    }
+
+    bitpack::pack_avx2<w>(wide, dst_bstr);
+    EXPECT_EQ(expected_bstr, dst_bstr);
+  }
+#endif
 }
 
 TEST(SaberKEM, PolynomialConversion)
@@ -38,3 +90,520 @@ TEST(SaberKEM, PolynomialConversion)
   test_poly_conversion<(1 << 12)>();
   test_poly_conversion<(1 << 13)>();
 }
+
+// Ensure that fused rounding and serialization of polynomials produces same byte string
+// as rounding, shifting and reducing them step by step, before serializing, using both
+// portable and vectorized kernels.
+template<uint16_t moduli, uint16_t new_moduli, size_t off, size_t sub_off>
+void
+test_round_to_bytes(prng::prng_t& prng)
+{
+  constexpr size_t blen = (saber_params::log2(new_moduli) * poly::N) / 8;
+  constexpr size_t w = saber_params::log2(new_moduli);
+
+  std::vector<uint8_t> rand_bstr(poly::N * 4 + 2);
+  prng.read(rand_bstr);
+
+  poly::poly_t<moduli> a, s, h;
+  for (size_t i = 0; i < poly::N; i++) {
+    a[i] = static_cast<uint16_t>(rand_bstr[2 * i] | (rand_bstr[2 * i + 1] << 8));
+    s[i] = static_cast<uint16_t>(rand_bstr[2 * (poly::N + i)] | (rand_bstr[2 * (poly::N + i) + 1] << 8));
+  }
+
+  const auto rc = static_cast<uint16_t>(rand_bstr[4 * poly::N] | (rand_bstr[4 * poly::N + 1] << 8));
+  for (size_t i = 0; i < poly::N; i++) {
+    h[i] = rc;
+  }
+
+  std::vector<uint8_t> expected(blen, 0);
+  std::vector<uint8_t> computed(blen, 0);
+
+  ((a + h) >> off).template mod<new_moduli>().to_bytes_generic(expected);
+  a.template round_to_bytes<new_moduli, off>(rc, computed);
+  EXPECT_EQ(expected, computed);
+
+  bitpack::round_pack<w, off, false, 0>(a.as_array(), a.as_array(), rc, computed);
+  EXPECT_EQ(expected, computed);
+
+  ((a - (s << sub_off) + h) >> off).template mod<new_moduli>().to_bytes_generic(expected);
+  a.template sub_round_to_bytes<new_moduli, off, sub_off>(s, rc, computed);
+  EXPECT_EQ(expected, computed);
+
+  bitpack::round_pack<w, off, true, sub_off>(a.as_array(), s.as_array(), rc, computed);
+  EXPECT_EQ(expected, computed);
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx2()) {
+    ((a + h) >> off).template mod<new_moduli>().to_bytes_generic(expected);
+    bitpack::round_pack_avx2<w, off, false, 0>(a.as_array(), a.as_array(), rc, computed);
+    EXPECT_EQ(expected, computed);
+
+    ((a - (s << sub_off) + h) >> off).template mod<new_moduli>().to_bytes_generic(expected);
+    bitpack::round_pack_avx2<w, off, true, sub_off>(a.as_array(), s.as_array(), rc, computed);
+    EXPECT_EQ(expected, computed);
+  }
+#endif
+}
+
+TEST(SaberKEM, FusedRoundingSerialization)
+{
+  prng::prng_t prng;
+
+  // public key/ cipher text vector, i.e. Rq -> Rp
+  test_round_to_bytes<(1 << 13), (1 << 10), 3, 0>(prng);
+  // cipher text message polynomial, i.e. Rp -> Rt
+  test_round_to_bytes<(1 << 10), (1 << 3), 7, 9>(prng);
+  test_round_to_bytes<(1 << 10), (1 << 4), 6, 9>(prng);
+  test_round_to_bytes<(1 << 10), (1 << 6), 4, 9>(prng);
+  // decrypted message, i.e. Rp -> R2
+  test_round_to_bytes<(1 << 10), (1 << 1), 9, 7>(prng);
+  test_round_to_bytes<(1 << 10), (1 << 1), 9, 4>(prng);
+  // widths not used by Saber, still supported by fused kernels
+  test_round_to_bytes<(1 << 12), (1 << 13), 0, 2>(prng);
+  test_round_to_bytes<(1 << 13), (1 << 12), 1, 1>(prng);
+  test_round_to_bytes<(1 << 13), (1 << 5), 8, 0>(prng);
+  test_round_to_bytes<(1 << 13), (1 << 2), 11, 3>(prng);
+}
+
+// Ensure that polynomials over small rings, stored in 8 -bit lanes, hold same
+// coefficients as `poly_t`, no matter which unpacking kernel is used, and that fused
+// rounding kernels compute same result, when subtracted polynomial is held in compact
+// form.
+template<uint16_t moduli>
+void
+test_poly8(prng::prng_t& prng)
+{
+  constexpr uint16_t P = 1 << 10;
+  constexpr size_t w = saber_params::log2(moduli);
+  constexpr size_t blen = (w * poly::N) / 8;
+  constexpr size_t pblen = (saber_params::log2(P) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr(blen);
+  std::vector<uint8_t> pbstr(pblen);
+  prng.read(bstr);
+  prng.read(pbstr);
+
+  const poly::poly_t<moduli> p(bstr);
+  const poly::poly8_t<moduli> p8(bstr);
+  const poly::poly_t<P> v(pbstr);
+
+  std::array<uint8_t, poly::N> generic;
+  bitpack::unpack_u8<w>(bstr, generic);
+
+  const auto wide = p8.to_poly();
+  const auto narrowed = poly::poly8_t<moduli>(p);
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(p[i].as_raw(), p8[i].as_raw());
+    EXPECT_EQ(p[i].as_raw(), wide[i].as_raw());
+    EXPECT_EQ(p[i].as_raw(), narrowed[i].as_raw());
+    EXPECT_EQ(p[i].as_raw(), generic[i]);
+  }
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_bmi2()) {
+    std::array<uint8_t, poly::N> bmi2;
+    bitpack::unpack_u8_bmi2<w>(bstr, bmi2);
+    EXPECT_EQ(generic, bmi2);
+  }
+#endif
+
+  std::vector<uint8_t> expected(32, 0);
+  std::vector<uint8_t> computed(32, 0);
+
+  v.template sub_round_to_bytes<2, 9, 10 - w>(p, 0x1234, expected);
+  v.template sub_round_to_bytes<2, 9, 10 - w>(p8, 0x1234, computed);
+  EXPECT_EQ(expected, computed);
+
+  bitpack::round_pack<1, 9, true, 10 - w>(v.as_array(), p8.as_array(), 0x1234, computed);
+  EXPECT_EQ(expected, computed);
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx2()) {
+    bitpack::round_pack_avx2<1, 9, true, 10 - w>(v.as_array(), p8.as_array(), 0x1234, computed);
+    EXPECT_EQ(expected, computed);
+  }
+#endif
+}
+
+// Same as above, for message polynomial, stored as a bitset.
+template<uint16_t new_moduli>
+void
+test_poly1(prng::prng_t& prng)
+{
+  constexpr uint16_t P = 1 << 10;
+  constexpr size_t w = saber_params::log2(new_moduli);
+  constexpr size_t pblen = (saber_params::log2(P) * poly::N) / 8;
+
+  std::array<uint8_t, poly::N / 8> msg;
+  std::vector<uint8_t> pbstr(pblen);
+  prng.read(msg);
+  prng.read(pbstr);
+
+  const poly::poly_t<2> m(msg);
+  const poly::poly1_t m1(msg);
+  const poly::poly_t<P> v(pbstr);
+
+  const auto wide = m1.to_poly();
+  const auto narrowed = poly::poly1_t(m);
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(m[i].as_raw(), m1[i].as_raw());
+    EXPECT_EQ(m[i].as_raw(), wide[i].as_raw());
+  }
+  EXPECT_EQ(m1.as_array(), narrowed.as_array());
+
+  std::array<uint8_t, poly::N / 8> msg_rt;
+  m1.to_bytes(msg_rt);
+  EXPECT_EQ(msg, msg_rt);
+
+  std::vector<uint8_t> expected(w * 32, 0);
+  std::vector<uint8_t> computed(w * 32, 0);
+
+  v.template sub_round_to_bytes<new_moduli, 10 - w, 9>(m, 0x0123, expected);
+  v.template sub_round_to_bytes<new_moduli, 10 - w, 9>(m1, 0x0123, computed);
+  EXPECT_EQ(expected, computed);
+
+  bitpack::round_pack<w, 10 - w, true, 9>(v.as_array(), m1.as_array(), 0x0123, computed);
+  EXPECT_EQ(expected, computed);
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx2()) {
+    bitpack::round_pack_avx2<w, 10 - w, true, 9>(v.as_array(), m1.as_array(), 0x0123, computed);
+    EXPECT_EQ(expected, computed);
+  }
+#endif
+}
+
+TEST(SaberKEM, CompactPolynomials)
+{
+  prng::prng_t prng;
+
+  test_poly8<(1 << 3)>(prng);
+  test_poly8<(1 << 4)>(prng);
+  test_poly8<(1 << 6)>(prng);
+
+  test_poly1<(1 << 3)>(prng);
+  test_poly1<(1 << 4)>(prng);
+  test_poly1<(1 << 6)>(prng);
+}
+
+// Ensure that lazily evaluated expressions over polynomials compute same coefficients,
+// as applying each operation on each coefficient, step by step, no matter whether
+// operands are named polynomials, temporaries or the polynomial being assigned to.
+TEST(SaberKEM, PolynomialExpressions)
+{
+  constexpr uint16_t P = 1 << 10;
+  constexpr uint16_t T = 1 << 3;
+  constexpr size_t blen = (saber_params::log2(P) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr(blen);
+  prng::prng_t prng;
+
+  prng.read(bstr);
+  poly::poly_t<P> a(bstr);
+  prng.read(bstr);
+  poly::poly_t<P> b(bstr);
+  prng.read(bstr);
+  poly::poly_t<P> c(bstr);
+
+  poly::poly_t<T> r = ((a - (b << 9) + c) >> 7).template mod<T>();
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(((a[i] - (b[i] << 9) + c[i]) >> 7).as_raw(), r[i].as_raw());
+  }
+
+  // Temporary operands are held by expression, until it's evaluated
+  const auto expr = poly::poly_t<P>(bstr) + a;
+  const poly::poly_t<P> sum = expr;
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ((c[i] + a[i]).as_raw(), sum[i].as_raw());
+  }
+
+  // Expression may refer to polynomial, it's assigned to
+  const auto a_copy = a;
+  a = (a << 1) + a - b;
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(((a_copy[i] << 1) + a_copy[i] - b[i]).as_raw(), a[i].as_raw());
+  }
+
+  // In-place operators, taking either a polynomial or an expression as right hand side
+  poly::poly_t<P> d = c;
+  ((d += a) -= (b << 2)) <<= 3;
+  d >>= 1;
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ((((c[i] + a[i] - (b[i] << 2)) << 3) >> 1).as_raw(), d[i].as_raw());
+  }
+
+  // Default constructed polynomial is zero, so that it can be accumulated into
+  poly::poly_t<P> z;
+  z += a;
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(z[i].as_raw(), a[i].as_raw());
+  }
+}
+
+// Given two polynomials of degree N-1, multiplies them using schoolbook algorithm and
+// reduces result modulo (x ** N + 1), so that it can be used as reference for testing
+// faster polynomial multiplication algorithms.
+static inline std::array<zq::zq_t, poly::N>
+schoolbook_mul(const std::array<zq::zq_t, poly::N>& polya, const std::array<zq::zq_t, poly::N>& polyb)
+{
+  std::array<zq::zq_t, poly::N> res{};
+
+  for (size_t i = 0; i < poly::N; i++) {
+    for (size_t j = 0; j < poly::N; j++) {
+      const auto prod = polya[i] * polyb[j];
+      const size_t k = i + j;
+
+      if (k < poly::N) {
+        res[k] = res[k] + prod;
+      } else {
+        res[k - poly::N] = res[k - poly::N] - prod;
+      }
+    }
+  }
+
+  return res;
+}
+
+// Ensure functional correctness of polynomial multiplication algorithms, by checking
+// that results computed by them match ones computed using schoolbook multiplication,
+// when reduced by `moduli`.
+template<uint16_t moduli>
+void
+test_poly_mul()
+{
+  constexpr size_t blen = (saber_params::log2(moduli) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr_a(blen, 0);
+  std::vector<uint8_t> bstr_b(blen, 0);
+
+  prng::prng_t prng;
+  prng.read(bstr_a);
+  prng.read(bstr_b);
+
+  std::array<zq::zq_t, poly::N> polya{};
+  std::array<zq::zq_t, poly::N> polyb{};
+
+  poly::poly_t<moduli> pa(bstr_a);
+  poly::poly_t<moduli> pb(bstr_b);
+
+  for (size_t i = 0; i < poly::N; i++) {
+    polya[i] = pa[i];
+    polyb[i] = pb[i];
+  }
+
+  const auto expected = schoolbook_mul(polya, polyb);
+  const auto computed0 = karatsuba::karamul(polya, polyb);
+  const auto computed1 = toom_cook::toom4mul(polya, polyb);
+  const auto computed2 = ntt::polymul(polya, polyb);
+  const auto computed3 = pa * pb;
+  const auto computed4 = kronecker::kronmul(polya, polyb);
+
+  for (size_t i = 0; i < poly::N; i++) {
+    EXPECT_EQ(expected[i].reduce_by<moduli>().as_raw(), computed0[i].reduce_by<moduli>().as_raw());
+    EXPECT_EQ(expected[i].reduce_by<moduli>().as_raw(), computed1[i].reduce_by<moduli>().as_raw());
+    EXPECT_EQ(expected[i].reduce_by<moduli>().as_raw(), computed2[i].reduce_by<moduli>().as_raw());
+    EXPECT_EQ(expected[i].reduce_by<moduli>().as_raw(), computed3[i].template reduce_by<moduli>().as_raw());
+    EXPECT_EQ(expected[i].reduce_by<moduli>().as_raw(), computed4[i].reduce_by<moduli>().as_raw());
+  }
+}
+
+TEST(SaberKEM, PolynomialMultiplication)
+{
+  test_poly_mul<(1 << 13)>();
+  test_poly_mul<(1 << 12)>();
+  test_poly_mul<(1 << 10)>();
+}
+
+// Ensure that Karatsuba multiplication computes same result, irrespective of where its
+// recursion is cut off and schoolbook multiplication ( vectorized, if available ) takes
+// over.
+template<size_t cutoff>
+void
+test_karatsuba_cutoff()
+{
+  constexpr size_t blen = (saber_params::log2(1u << 13) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr_a(blen, 0);
+  std::vector<uint8_t> bstr_b(blen, 0);
+
+  prng::prng_t prng;
+  prng.read(bstr_a);
+  prng.read(bstr_b);
+
+  std::array<zq::zq_t, poly::N> polya{};
+  std::array<zq::zq_t, poly::N> polyb{};
+
+  poly::poly_t<(1u << 13)> pa(bstr_a);
+  poly::poly_t<(1u << 13)> pb(bstr_b);
+
+  for (size_t i = 0; i < poly::N; i++) {
+    polya[i] = pa[i];
+    polyb[i] = pb[i];
+  }
+
+  const auto expected = schoolbook::mul_scalar(polya, polyb);
+  const auto computed = karatsuba::karatsuba<poly::N, cutoff>(polya, polyb);
+
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(expected[i].as_raw(), computed[i].as_raw());
+  }
+}
+
+TEST(SaberKEM, KaratsubaRecursionCutoff)
+{
+  test_karatsuba_cutoff<1>();
+  test_karatsuba_cutoff<8>();
+  test_karatsuba_cutoff<16>();
+  test_karatsuba_cutoff<32>();
+  test_karatsuba_cutoff<64>();
+  test_karatsuba_cutoff<poly::N>();
+}
+
+// Ensure that batched multiplication of independent pairs of polynomials, one pair per
+// lane, computes same result as multiplying each pair on its own.
+template<uint16_t moduli, size_t lanes>
+void
+test_batch_poly_mul()
+{
+  constexpr size_t blen = (saber_params::log2(moduli) * poly::N) / 8;
+
+  std::vector<uint8_t> bstr(blen, 0);
+  prng::prng_t prng;
+
+  std::array<poly::poly_t<moduli>, lanes> polya;
+  std::array<poly::poly_t<moduli>, lanes> polyb;
+  std::array<poly::poly_t<moduli>, lanes> polyab;
+
+  for (size_t l = 0; l < lanes; l++) {
+    prng.read(bstr);
+    polya[l] = poly::poly_t<moduli>(bstr);
+    prng.read(bstr);
+    polyb[l] = poly::poly_t<moduli>(bstr);
+  }
+
+  polymul_batch::polymul<moduli, lanes>(polya, polyb, polyab);
+
+  for (size_t l = 0; l < lanes; l++) {
+    const auto expected = karatsuba::karamul(polya[l].as_array(), polyb[l].as_array());
+
+    for (size_t i = 0; i < poly::N; i++) {
+      EXPECT_EQ(expected[i].as_raw(), polyab[l][i].as_raw());
+    }
+  }
+}
+
+TEST(SaberKEM, BatchedPolynomialMultiplication)
+{
+  test_batch_poly_mul<(1 << 13), polymul_batch::LANES>();
+  test_batch_poly_mul<(1 << 10), polymul_batch::LANES>();
+  test_batch_poly_mul<(1 << 13), 32>();
+  test_batch_poly_mul<(1 << 13), 1>();
+}
+
+// Compares two arrays of Zq elements, element by element.
+template<size_t L>
+static inline void
+expect_same(const std::array<zq::zq_t, L>& expected, const std::array<zq::zq_t, L>& computed)
+{
+  for (size_t i = 0; i < L; i++) {
+    EXPECT_EQ(expected[i].as_raw(), computed[i].as_raw());
+  }
+}
+
+// Ensure that each instruction set specific variant of hot kernels, which can be
+// executed on this CPU, computes same result as portable implementation, irrespective of
+// which one of them is selected at runtime.
+template<size_t N>
+void
+test_schoolbook_variants(prng::prng_t& prng)
+{
+  std::array<zq::zq_t, N> polya;
+  std::array<zq::zq_t, N> polyb;
+  std::array<zq::zq_t, 2 * N> init;
+
+  std::vector<uint8_t> bytes(sizeof(polya) + sizeof(polyb) + sizeof(init));
+  prng.read(bytes);
+
+  std::memcpy(polya.data(), bytes.data(), sizeof(polya));
+  std::memcpy(polyb.data(), bytes.data() + sizeof(polya), sizeof(polyb));
+  std::memcpy(init.data(), bytes.data() + sizeof(polya) + sizeof(polyb), sizeof(init));
+
+  std::array<zq::zq_t, 2 * N> expected = init;
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) {
+      expected[i + j] += polya[i] * polyb[j];
+    }
+  }
+
+  auto computed = init;
+  schoolbook::mul_acc<N>(polya, polyb, computed);
+  expect_same(expected, computed);
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx2()) {
+    computed = init;
+    schoolbook::mul_acc_avx2<N>(polya, polyb, computed);
+    expect_same(expected, computed);
+  }
+  if (dispatch::has_avx512()) {
+    computed = init;
+    schoolbook::mul_acc_avx512<N>(polya, polyb, computed);
+    expect_same(expected, computed);
+  }
+#endif
+}
+
+template<uint16_t moduli, size_t mu>
+void
+test_cbd_variants(prng::prng_t& prng)
+{
+  std::array<uint8_t, (poly::N * mu) / 8> bytes;
+  prng.read(bytes);
+
+  const auto expected = saber_utils::cbd_generic<moduli, mu>(bytes);
+  expect_same(expected.as_array(), saber_utils::cbd<moduli, mu>(bytes).as_array());
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx2()) {
+    expect_same(expected.as_array(), saber_utils::cbd_avx2<moduli, mu>(bytes).as_array());
+  }
+  if (dispatch::has_avx512()) {
+    expect_same(expected.as_array(), saber_utils::cbd_avx512<moduli, mu>(bytes).as_array());
+  }
+#endif
+}
+
+template<uint16_t moduli>
+void
+test_uniform_sample_variants(prng::prng_t& prng)
+{
+  std::array<uint8_t, (poly::N * 2) / 8> bytes;
+  prng.read(bytes);
+
+  const auto expected = saber_utils::uniform_sample_generic<moduli>(bytes);
+  expect_same(expected.as_array(), saber_utils::uniform_sample<moduli>(bytes).as_array());
+
+#if defined SABER_DISPATCH
+  if (dispatch::has_avx2()) {
+    expect_same(expected.as_array(), saber_utils::uniform_sample_avx2<moduli>(bytes).as_array());
+  }
+  if (dispatch::has_avx512()) {
+    expect_same(expected.as_array(), saber_utils::uniform_sample_avx512<moduli>(bytes).as_array());
+  }
+#endif
+}
+
+TEST(SaberKEM, DispatchedKernelVariants)
+{
+  prng::prng_t prng;
+
+  test_schoolbook_variants<16>(prng);
+  test_schoolbook_variants<32>(prng);
+  test_schoolbook_variants<64>(prng);
+  test_schoolbook_variants<128>(prng);
+
+  test_cbd_variants<(1 << 13), 10>(prng);
+  test_cbd_variants<(1 << 13), 8>(prng);
+  test_cbd_variants<(1 << 13), 6>(prng);
+  test_uniform_sample_variants<(1 << 12)>(prng);
+}